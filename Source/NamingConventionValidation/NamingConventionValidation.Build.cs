@@ -28,8 +28,12 @@ namespace UnrealBuildTool.Rules
                     "SlateCore",
                     "UnrealEd",
                     "AssetRegistry",
+                    "AssetTools",
                     "EditorStyle",
-                    "Blutility"
+                    "Blutility",
+                    "ContentBrowser",
+                    "ContentBrowserData",
+                    "Projects"
                 }
             );
         }
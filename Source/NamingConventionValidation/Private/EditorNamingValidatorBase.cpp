@@ -3,11 +3,20 @@
 UEditorNamingValidatorBase::UEditorNamingValidatorBase()
 {
     bIsEnabled = true;
+    TimeBudgetSeconds = 0.0f;
 }
 
 bool UEditorNamingValidatorBase::CanValidateAssetNaming_Implementation(const UClass* /*AssetClass*/, const FAssetData& /*AssetData*/) const
 {
-    return false;
+    if (!SupportedPathRoots.IsEmpty())
+    {
+        return true;
+    }
+
+    // The native validators may declare their classes by overriding GetSupportedAssetClasses rather than through SupportedAssetClasses
+    TArray<FTopLevelAssetPath> SupportedClassPaths;
+    GetSupportedAssetClasses(SupportedClassPaths);
+    return !SupportedClassPaths.IsEmpty();
 }
 
 ENamingConventionValidationResult UEditorNamingValidatorBase::ValidateAssetNaming_Implementation(FText& /*ErrorMessage*/, const UClass* /*AssetClass*/, const FAssetData& /*AssetData*/)
@@ -19,3 +28,68 @@ bool UEditorNamingValidatorBase::IsEnabled() const
 {
     return bIsEnabled;
 }
+
+float UEditorNamingValidatorBase::GetTimeBudgetSeconds() const
+{
+    return TimeBudgetSeconds;
+}
+
+void UEditorNamingValidatorBase::GetSupportedAssetClasses(TArray<FTopLevelAssetPath>& OutClassPaths) const
+{
+    for (const TSoftClassPtr<UObject>& SupportedAssetClass : SupportedAssetClasses)
+    {
+        OutClassPaths.Add(SupportedAssetClass.ToSoftObjectPath().GetAssetPath());
+    }
+}
+
+bool UEditorNamingValidatorBase::SupportsAssetClass(const UClass* AssetClass) const
+{
+    TArray<FTopLevelAssetPath> SupportedClassPaths;
+    GetSupportedAssetClasses(SupportedClassPaths);
+
+    if (SupportedClassPaths.IsEmpty())
+    {
+        return true;
+    }
+
+    // A class which is not loaded cannot be the parent of a loaded one, so nothing is loaded here
+    for (const FTopLevelAssetPath& SupportedClassPath : SupportedClassPaths)
+    {
+        const UClass* SupportedClass = FindObject<UClass>(SupportedClassPath);
+        if (AssetClass != nullptr && SupportedClass != nullptr && AssetClass->IsChildOf(SupportedClass))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool UEditorNamingValidatorBase::SupportsPackageName(const FName PackageName) const
+{
+    if (SupportedPathRoots.IsEmpty())
+    {
+        return true;
+    }
+
+    const FNameBuilder PackageNameBuilder(PackageName);
+
+    for (const FDirectoryPath& SupportedPathRoot : SupportedPathRoots)
+    {
+        // Followed by a slash, so that only whole folder names match
+        FStringView PathRoot = SupportedPathRoot.Path;
+        if (PathRoot.EndsWith(TEXT('/')))
+        {
+            PathRoot.LeftChopInline(1);
+        }
+
+        const FStringView PackageNameView = PackageNameBuilder.ToView();
+
+        if (PackageNameView.Len() > PathRoot.Len() && PackageNameView.StartsWith(PathRoot) && PackageNameView[PathRoot.Len()] == TEXT('/'))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -1,43 +1,168 @@
 #include "EditorNamingValidatorSubsystem.h"
 
+#include "NamingConventionValidationCache.h"
+#include "NamingConventionValidationLog.h"
+#include "NamingConventionValidationReport.h"
 #include "NamingConventionValidationSettings.h"
+#include "NamingConventionValidationStats.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
 #include "Editor.h"
 #include "EditorNamingValidatorBase.h"
 #include "EditorUtilityBlueprint.h"
+#include "Hash/CityHash.h"
+#include "HAL/FileManager.h"
 #include "Logging/MessageLog.h"
 #include "MessageLogInitializationOptions.h"
 #include "MessageLogModule.h"
 #include "Misc/ScopedSlowTask.h"
+#include "Tasks/Task.h"
+#include "UObject/UObjectGlobals.h"
 #include "UObject/UObjectHash.h"
 
 #define LOCTEXT_NAMESPACE "NamingConventionValidationManager"
 
-bool TryGetAssetDataRealClass(FName& AssetClass, const FAssetData& AssetData)
+enum class EAssetClassResolution : uint8
 {
-    static const FName NativeParentClassKey("NativeParentClass");
-    static const FName NativeClassKey("NativeClass");
+    Resolved,
+    RequiresLoad
+};
+
+bool TryGetNativeClassPath(FName& AssetClass, const FTopLevelAssetPath& ClassPath)
+{
+    if (ClassPath.IsValid() && FindObject<UClass>(ClassPath) != nullptr)
+    {
+        AssetClass = *ClassPath.ToString();
+        return true;
+    }
+
+    return false;
+}
+
+// Resolves the class of the asset from the registry only: its class path, its blueprint parent class, then the registry class hierarchy
+bool TryGetAssetDataRegistryClass(FName& AssetClass, const FAssetData& AssetData)
+{
+    FTopLevelAssetPath ClassPath = AssetData.AssetClassPath;
 
-    if (!AssetData.GetTagValue(NativeParentClassKey, AssetClass))
+    FString ParentClassName;
+    if (AssetData.GetTagValue(FBlueprintTags::ParentClassPath, ParentClassName))
     {
-        if (!AssetData.GetTagValue(NativeClassKey, AssetClass))
+        ClassPath = FTopLevelAssetPath(FPackageName::ExportTextPathToObjectPath(ParentClassName));
+
+        if (TryGetNativeClassPath(AssetClass, ClassPath))
         {
-            if (const UObject* Asset = AssetData.GetAsset())
-            {
-                const FSoftClassPath ClassPath(Asset->GetClass());
-                AssetClass = *ClassPath.ToString();
-            }
-            else
+            return true;
+        }
+    }
+
+    TArray<FTopLevelAssetPath> AncestorClassNames;
+    if (ClassPath.IsValid() && IAssetRegistry::GetChecked().GetAncestorClassNames(ClassPath, AncestorClassNames))
+    {
+        for (const FTopLevelAssetPath& AncestorClassName : AncestorClassNames)
+        {
+            if (TryGetNativeClassPath(AssetClass, AncestorClassName))
             {
-                return false;
+                return true;
             }
         }
     }
 
-    return true;
+    return false;
+}
+
+// Never loads anything, but looks up the classes, which is not safe while the game thread collects garbage or saves packages
+EAssetClassResolution TryGetAssetDataRealClass(FName& AssetClass, const FAssetData& AssetData, const bool bAllowLoading)
+{
+    NAMING_CONVENTION_VALIDATION_SCOPE(STAT_NamingConventionValidation_ClassResolution);
+
+    static const FName NativeParentClassKey("NativeParentClass");
+    static const FName NativeClassKey("NativeClass");
+
+    if (AssetData.GetTagValue(NativeParentClassKey, AssetClass) || AssetData.GetTagValue(NativeClassKey, AssetClass))
+    {
+        return EAssetClassResolution::Resolved;
+    }
+
+    // Loading the asset would give the same class when it is a native one
+    if (TryGetNativeClassPath(AssetClass, AssetData.AssetClassPath))
+    {
+        return EAssetClassResolution::Resolved;
+    }
+
+    if (!bAllowLoading && TryGetAssetDataRegistryClass(AssetClass, AssetData))
+    {
+        return EAssetClassResolution::Resolved;
+    }
+
+    return EAssetClassResolution::RequiresLoad;
+}
+
+bool TryLoadAssetDataRealClass(FName& AssetClass, const FAssetData& AssetData)
+{
+    NAMING_CONVENTION_VALIDATION_SCOPE(STAT_NamingConventionValidation_AssetLoad);
+
+    const bool bWasLoaded = AssetData.IsAssetLoaded();
+    if (const UObject* Asset = AssetData.GetAsset())
+    {
+        if (!bWasLoaded)
+        {
+            INC_DWORD_STAT(STAT_NamingConventionValidation_AssetsLoaded);
+            TRACE_COUNTER_INCREMENT(NamingConventionValidation_AssetsLoaded);
+        }
+
+        const FSoftClassPath ClassPath(Asset->GetClass());
+        AssetClass = *ClassPath.ToString();
+        return true;
+    }
+
+    return false;
 }
 
+// State of the validation of a single asset, carried from the parallel stage of ValidateAssets to its game thread stage
+struct FNamingConventionAssetValidation
+{
+    enum class EGameThreadStage : uint8
+    {
+        // The result is final
+        None,
+        // Only the editor validators are left to run. Result and Message are used if none of them gives a verdict
+        Validators,
+        // The asset or its class has to be loaded, so the rest of the validation has to run on the game thread
+        Load
+    };
+
+    ENamingConventionValidationResult Result = ENamingConventionValidationResult::Unknown;
+    FNamingConventionValidationMessage Message;
+    FName AssetClassName;
+    const UClass* AssetClass = nullptr;
+
+    // Set by ResolveAssetClass. The native class is resolved from the registry, the real class as allowed by bAllowLoading
+    const UClass* AssetNativeClass = nullptr;
+    const UClass* AssetRealClass = nullptr;
+    bool bRealClassRequiresLoad = false;
+    bool bAllowLoading = false;
+    EGameThreadStage GameThreadStage = EGameThreadStage::None;
+    bool bIsCached = false;
+};
+
+// Assets validated together by the live validation. The parallel stage runs in a background task
+struct FNamingConventionLiveValidationBatch
+{
+    // Bounds the duration of the game thread stage of a batch
+    static constexpr int32 MaxNumAssets = 4096;
+
+    TArray<FAssetData> Assets;
+    TArray<FNamingConventionAssetValidation> Validations;
+    UE::Tasks::FTask Task;
+
+    // The classes resolved before the task starts, which are checked again once it is done as a garbage collection may have run since
+    TArray<TWeakObjectPtr<const UClass>> AssetClasses;
+
+    // Assets removed or renamed while the batch runs, whose results are ignored
+    TSet<FSoftObjectPath> RemovedAssets;
+};
+
 UEditorNamingValidatorSubsystem::UEditorNamingValidatorSubsystem()
 {
     bAllowBlueprintValidators = true;
@@ -59,6 +184,14 @@ void UEditorNamingValidatorSubsystem::Initialize(FSubsystemCollectionBase& /*Col
         }
     }
 
+    AssetRegistryModule.Get().OnAssetAdded().AddUObject(this, &UEditorNamingValidatorSubsystem::OnAssetAdded);
+    AssetRegistryModule.Get().OnAssetRemoved().AddUObject(this, &UEditorNamingValidatorSubsystem::OnAssetRemoved);
+    AssetRegistryModule.Get().OnAssetUpdated().AddUObject(this, &UEditorNamingValidatorSubsystem::OnAssetUpdated);
+    AssetRegistryModule.Get().OnAssetRenamed().AddUObject(this, &UEditorNamingValidatorSubsystem::OnAssetRenamed);
+
+    LiveValidationTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UEditorNamingValidatorSubsystem::TickLiveValidation));
+    FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddUObject(this, &UEditorNamingValidatorSubsystem::WaitForLiveValidationBatch);
+
     TArray<UClass*> ValidatorClasses;
     GetDerivedClasses(UEditorNamingValidatorBase::StaticClass(), ValidatorClasses);
     for (const UClass* ValidatorClass : ValidatorClasses)
@@ -84,17 +217,46 @@ void UEditorNamingValidatorSubsystem::Initialize(FSubsystemCollectionBase& /*Col
     MessageLogModule.RegisterLogListing("NamingConventionValidation", LOCTEXT("NamingConventionValidation", "Naming Convention Validation"), InitOptions);
 
     UNamingConventionValidationSettings* Settings = GetMutableDefault<UNamingConventionValidationSettings>();
+    Settings->OnSettingsChanging.AddUObject(this, &UEditorNamingValidatorSubsystem::OnSettingsChanging);
     Settings->PostProcessSettings();
 }
 
 void UEditorNamingValidatorSubsystem::Deinitialize()
 {
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetRegistry->OnFilesLoaded().RemoveAll(this);
+        AssetRegistry->OnAssetAdded().RemoveAll(this);
+        AssetRegistry->OnAssetRemoved().RemoveAll(this);
+        AssetRegistry->OnAssetUpdated().RemoveAll(this);
+        AssetRegistry->OnAssetRenamed().RemoveAll(this);
+    }
+
+    FTSTicker::GetCoreTicker().RemoveTicker(LiveValidationTickerHandle);
+    FCoreUObjectDelegates::GetPreGarbageCollectDelegate().RemoveAll(this);
+    GetMutableDefault<UNamingConventionValidationSettings>()->OnSettingsChanging.RemoveAll(this);
+
+    // The background task of the live validation uses the subsystem
+    WaitForLiveValidationBatch();
+    LiveValidationBatch.Reset();
+
     CleanupValidators();
     Super::Deinitialize();
 }
 
 int32 UEditorNamingValidatorSubsystem::ValidateAssets(const TArray< FAssetData >& AssetDataList, bool /*bSkipIncludedDirectories*/, const bool bShowIfNoFailures) const
 {
+    FNamingConventionValidationOptions Options;
+    Options.bShowIfNoFailures = bShowIfNoFailures;
+    return ValidateAssets(AssetDataList, Options);
+}
+
+int32 UEditorNamingValidatorSubsystem::ValidateAssets(const TArray<FAssetData>& AssetDataList, const FNamingConventionValidationOptions& Options) const
+{
+    NAMING_CONVENTION_VALIDATION_SCOPE(STAT_NamingConventionValidation_ValidateAssets);
+    INC_DWORD_STAT_BY(STAT_NamingConventionValidation_AssetsValidated, AssetDataList.Num());
+
+    const bool bShowIfNoFailures = Options.bShowIfNoFailures;
     const UNamingConventionValidationSettings* Settings = GetDefault<UNamingConventionValidationSettings>();
 
     FScopedSlowTask SlowTask(1.0f, LOCTEXT("NamingConventionValidatingDataTask", "Validating Naming Convention..."));
@@ -105,95 +267,181 @@ int32 UEditorNamingValidatorSubsystem::ValidateAssets(const TArray< FAssetData >
         SlowTask.MakeDialogDelayed(0.1f);
     }
 
-    FMessageLog DataValidationLog("NamingConventionValidation");
+    TOptional<FNamingConventionValidationMessageLogSink> MessageLogSink;
+    TArray<INamingConventionValidationReportSink*, TInlineAllocator<4>> ReportSinks(Options.ReportSinks);
+
+    if (Options.bUseMessageLog)
+    {
+        ReportSinks.Add(&MessageLogSink.Emplace(bShowIfNoFailures));
+    }
+
+    for (INamingConventionValidationReportSink* ReportSink : ReportSinks)
+    {
+        ReportSink->BeginReport();
+    }
 
-    int32 NumFilesChecked = 0;
-    int32 NumValidFiles = 0;
-    int32 NumInvalidFiles = 0;
-    int32 NumFilesSkipped = 0;
-    int32 NumFilesUnableToValidate = 0;
+    FNamingConventionValidationSummary Summary;
+    Summary.NumFilesToValidate = AssetDataList.Num();
+    Summary.bUsedCache = Options.Cache != nullptr;
 
     const int32 NumFilesToValidate = AssetDataList.Num();
+    const bool bRunValidators = HasEnabledValidators();
+    const bool bAllowLoading = Settings->bAllowLoadingAssetsToResolveClass && !Options.bNeverLoadAssets;
+
+    Settings->UpdateClassAncestryIndex();
+
+    // The declarations of the validators may have been edited since the last validation
+    ValidatorsByAssetClass.Reset();
+    ValidatorStats.Reset();
+    bHasDisabledValidators = false;
+
+    // Assets are processed in batches: the checks which do not need the game thread run in parallel over the batch,
+    // then the remaining ones run on the game thread and the results are logged in the order of AssetDataList.
+    static constexpr int32 BatchSize = 16384;
+    static constexpr int32 ChunkSize = 256;
 
-    for (const FAssetData& AssetData : AssetDataList)
+    TArray<FNamingConventionAssetValidation> Validations;
+
+    for (int32 BatchStart = 0; BatchStart < NumFilesToValidate; BatchStart += BatchSize)
     {
-        SlowTask.EnterProgressFrame(1.0f / static_cast<float>(NumFilesToValidate), FText::Format(LOCTEXT("ValidatingNamingConventionFilename", "Validating Naming Convention {0}"), FText::FromString(AssetData.GetFullName())));
+        const int32 BatchNum = FMath::Min(BatchSize, NumFilesToValidate - BatchStart);
 
-        FText ErrorMessage;
-        const ENamingConventionValidationResult Result = IsAssetNamedCorrectly(ErrorMessage, AssetData);
+        SlowTask.EnterProgressFrame(static_cast<float>(BatchNum) / static_cast<float>(NumFilesToValidate), FText::Format(LOCTEXT("ValidatingNamingConventionBatch", "Validating Naming Convention {0} / {1}"), BatchStart + BatchNum, NumFilesToValidate));
 
-        switch (Result)
-        {
-        case ENamingConventionValidationResult::Excluded:
-        {
-            DataValidationLog.Info()
-                ->AddToken(FAssetNameToken::Create(AssetData.PackageName.ToString()))
-                ->AddToken(FTextToken::Create(LOCTEXT("ExcludedNamingConventionResult", "has not been tested based on the configuration.")))
-                ->AddToken(FTextToken::Create(ErrorMessage));
+        Validations.Reset();
+        Validations.SetNum(BatchNum);
 
-            ++NumFilesSkipped;
-        }
-        break;
-        case ENamingConventionValidationResult::Valid:
+        ParallelFor(FMath::DivideAndRoundUp(BatchNum, ChunkSize), [&](const int32 ChunkIndex)
         {
-            ++NumValidFiles;
-            ++NumFilesChecked;
-        }
-        break;
-        case ENamingConventionValidationResult::Invalid:
-        {
-            DataValidationLog.Error()
-                ->AddToken(FAssetNameToken::Create(AssetData.PackageName.ToString()))
-                ->AddToken(FTextToken::Create(LOCTEXT("InvalidNamingConventionResult", "does not match naming convention.")))
-                ->AddToken(FTextToken::Create(ErrorMessage));
+            const int32 ChunkEnd = FMath::Min((ChunkIndex + 1) * ChunkSize, BatchNum);
+            for (int32 Index = ChunkIndex * ChunkSize; Index < ChunkEnd; ++Index)
+            {
+                FNamingConventionAssetValidation& Validation = Validations[Index];
+                const FAssetData& AssetData = AssetDataList[BatchStart + Index];
 
-            ++NumInvalidFiles;
-            ++NumFilesChecked;
-        }
-        break;
-        case ENamingConventionValidationResult::Unknown:
+                Validation.bIsCached = Options.Cache != nullptr && Options.Cache->TryGetResult(AssetData, Validation.Result, Validation.Message);
+                if (!Validation.bIsCached)
+                {
+                    ResolveAssetClass(Validation, AssetData, bAllowLoading);
+                    ValidateAssetOffGameThread(Validation, AssetData, bRunValidators);
+                }
+            }
+        });
+
+        for (int32 Index = 0; Index < BatchNum; ++Index)
         {
-            if (bShowIfNoFailures && Settings->bLogWarningWhenNoClassDescriptionForAsset)
+            const FAssetData& AssetData = AssetDataList[BatchStart + Index];
+            FNamingConventionAssetValidation& Validation = Validations[Index];
+
+            ValidateAssetOnGameThread(Validation, AssetData, bRunValidators);
+
+            if (Options.Cache != nullptr)
+            {
+                if (Validation.bIsCached)
+                {
+                    Options.Cache->KeepResult(AssetData);
+                    ++Summary.NumFilesFromCache;
+                }
+                // Once a validator has been disabled, the results do not match the ones of a complete validation anymore
+                else if (Validation.Result != ENamingConventionValidationResult::Deferred && !bHasDisabledValidators)
+                {
+                    Options.Cache->AddResult(AssetData, Validation.Result, Validation.Message);
+                }
+            }
+
+            Summary.AddResult(Validation.Result);
+
+            if (Options.bUpdateViolationIndex && Validation.Result != ENamingConventionValidationResult::Deferred)
             {
-                FFormatNamedArguments Arguments;
-                Arguments.Add(TEXT("ClassName"), FText::FromString(AssetData.AssetClassPath.ToString()));
+                ViolationIndex.Update(AssetData, Validation.Result, Validation.Message);
+            }
 
-                DataValidationLog.Warning()
-                    ->AddToken(FAssetNameToken::Create(AssetData.PackageName.ToString()))
-                    ->AddToken(FTextToken::Create(LOCTEXT("UnknownNamingConventionResult", "has no known naming convention.")))
-                    ->AddToken(FTextToken::Create(FText::Format(LOCTEXT("UnknownClass", " Class = {ClassName}"), Arguments)));
+            for (INamingConventionValidationReportSink* ReportSink : ReportSinks)
+            {
+                ReportSink->AddResult(AssetData, Validation.Result, Validation.Message);
             }
-            ++NumFilesChecked;
-            ++NumFilesUnableToValidate;
         }
-        break;
+    }
+
+    Summary.ValidatorStats = GetValidatorStats();
+
+    for (INamingConventionValidationReportSink* ReportSink : ReportSinks)
+    {
+        ReportSink->EndReport(Summary);
+    }
+
+    // The validation of the saved packages runs at every time slice, the explicit runs already show the stats in the message log and the reports
+    for (const FNamingConventionValidatorStats& Stats : Summary.ValidatorStats)
+    {
+        UE_LOG(LogNamingConventionValidation, Verbose, TEXT("Validator %s: %lld calls, %lld validations, %lld verdicts, %.1f ms total, %.2f ms max%s"),
+            *Stats.ValidatorName,
+            Stats.NumCalls,
+            Stats.NumValidations,
+            Stats.NumVerdicts,
+            Stats.TotalSeconds * 1000.0,
+            Stats.MaxSeconds * 1000.0,
+            Stats.bIsDisabled ? TEXT(", disabled") : Stats.bIsDemoted ? TEXT(", demoted") : TEXT(""));
+    }
+
+    int64 ClassVerdictCacheHits = 0;
+    int64 ClassVerdictCacheMisses = 0;
+    Settings->GetClassVerdictCacheStats(ClassVerdictCacheHits, ClassVerdictCacheMisses);
+    UE_CLOG(Options.Cache != nullptr, LogNamingConventionValidation, Log, TEXT("Reused %d cached results out of %d assets"), Summary.NumFilesFromCache, NumFilesToValidate);
+    UE_CLOG(Summary.NumFilesDeferred > 0, LogNamingConventionValidation, Log, TEXT("%d assets were not validated because resolving their class would have required loading them"), Summary.NumFilesDeferred);
+    UE_LOG(LogNamingConventionValidation, Verbose, TEXT("Class verdict cache: %lld hits, %lld misses"), ClassVerdictCacheHits, ClassVerdictCacheMisses);
+
+    return Summary.NumInvalidFiles;
+}
+
+uint64 UEditorNamingValidatorSubsystem::GetValidationFingerprint() const
+{
+    const UNamingConventionValidationSettings* Settings = GetDefault<UNamingConventionValidationSettings>();
+
+    FString FingerprintText;
+
+    for (TFieldIterator<FProperty> PropertyIt(Settings->GetClass()); PropertyIt; ++PropertyIt)
+    {
+        if (PropertyIt->HasAnyPropertyFlags(CPF_Config))
+        {
+            FString PropertyValue;
+            PropertyIt->ExportTextItem_Direct(PropertyValue, PropertyIt->ContainerPtrToValuePtr<void>(Settings), nullptr, nullptr, PPF_None);
+            FingerprintText.Appendf(TEXT("%s=%s\n"), *PropertyIt->GetName(), *PropertyValue);
         }
     }
 
-    const bool bHasFailed = NumInvalidFiles > 0;
+    TArray<FString> ValidatorNames;
 
-    if (bHasFailed || bShowIfNoFailures)
+    WaitForBlueprintValidators();
+
+    for (const TPair<UClass*, UEditorNamingValidatorBase*>& ValidatorPair : Validators)
     {
-        FFormatNamedArguments Arguments;
-        Arguments.Add(TEXT("Result"), bHasFailed ? LOCTEXT("Failed", "FAILED") : LOCTEXT("Succeeded", "SUCCEEDED"));
-        Arguments.Add(TEXT("NumChecked"), NumFilesChecked);
-        Arguments.Add(TEXT("NumValid"), NumValidFiles);
-        Arguments.Add(TEXT("NumInvalid"), NumInvalidFiles);
-        Arguments.Add(TEXT("NumSkipped"), NumFilesSkipped);
-        Arguments.Add(TEXT("NumUnableToValidate"), NumFilesUnableToValidate);
+        if (ValidatorPair.Value == nullptr || !ValidatorPair.Value->IsEnabled())
+        {
+            continue;
+        }
+
+        FString ValidatorName = ValidatorPair.Key->GetPathName();
 
-        TSharedRef<FTokenizedMessage> ValidationLog = bHasFailed ? DataValidationLog.Error() : DataValidationLog.Info();
-        ValidationLog->AddToken(FTextToken::Create(FText::Format(LOCTEXT("SuccessOrFailure", "NamingConvention Validation {Result}."), Arguments)));
-        ValidationLog->AddToken(FTextToken::Create(FText::Format(LOCTEXT("ResultsSummary", "Files Checked: {NumChecked}, Passed: {NumValid}, Failed: {NumInvalid}, Skipped: {NumSkipped}, Unable to validate: {NumUnableToValidate}"), Arguments)));
+        // Blueprint validators can change without their name changing
+        FString ValidatorFilename;
+        if (!ValidatorPair.Key->HasAnyClassFlags(CLASS_Native) && FPackageName::DoesPackageExist(ValidatorPair.Key->GetOutermost()->GetName(), &ValidatorFilename))
+        {
+            ValidatorName.Appendf(TEXT("@%lld"), IFileManager::Get().GetTimeStamp(*ValidatorFilename).GetTicks());
+        }
 
-        DataValidationLog.Open(EMessageSeverity::Info, true);
+        ValidatorNames.Add(MoveTemp(ValidatorName));
     }
 
-    return NumInvalidFiles;
+    ValidatorNames.Sort();
+    FingerprintText += FString::Join(ValidatorNames, TEXT("\n"));
+
+    return CityHash64(reinterpret_cast<const char*>(*FingerprintText), FingerprintText.Len() * sizeof(TCHAR));
 }
 
 void UEditorNamingValidatorSubsystem::ValidateSavedPackage(const FName PackageName)
 {
+    NAMING_CONVENTION_VALIDATION_SCOPE(STAT_NamingConventionValidation_ValidateOnSave);
+
     if (ensure(GEditor))
     {
         const UNamingConventionValidationSettings* Settings = GetDefault<UNamingConventionValidationSettings>();
@@ -202,8 +450,17 @@ void UEditorNamingValidatorSubsystem::ValidateSavedPackage(const FName PackageNa
             return;
         }
 
-        SavedPackagesToValidate.AddUnique(PackageName);
-        GEditor->GetTimerManager()->SetTimerForNextTick(this, &UEditorNamingValidatorSubsystem::ValidateAllSavedPackages);
+        SavedPackagesToValidate.Add(PackageName);
+
+        // Every save restarts the timer, so a bulk save is validated once it is over
+        if (Settings->ValidateOnSaveDebounceSeconds > 0.0f)
+        {
+            GEditor->GetTimerManager()->SetTimer(ValidateSavedPackagesTimerHandle, this, &UEditorNamingValidatorSubsystem::ValidateAllSavedPackages, Settings->ValidateOnSaveDebounceSeconds, false);
+        }
+        else if (!GEditor->GetTimerManager()->TimerExists(ValidateSavedPackagesTimerHandle))
+        {
+            ValidateSavedPackagesTimerHandle = GEditor->GetTimerManager()->SetTimerForNextTick(this, &UEditorNamingValidatorSubsystem::ValidateAllSavedPackages);
+        }
     }
 }
 
@@ -212,41 +469,52 @@ void UEditorNamingValidatorSubsystem::AddValidator(UEditorNamingValidatorBase* V
     if (IsValid(Validator))
     {
         Validators.Add(Validator->GetClass(), Validator);
+        ValidatorsByAssetClass.Reset();
     }
 }
 
 ENamingConventionValidationResult UEditorNamingValidatorSubsystem::IsAssetNamedCorrectly(FText& ErrorMessage, const FAssetData& AssetData, bool bCanUseEditorValidators) const
 {
-    const UNamingConventionValidationSettings* Settings = GetDefault<UNamingConventionValidationSettings>();
-    if (Settings->IsPathExcludedFromValidation(AssetData.PackageName.ToString()))
-    {
-        ErrorMessage = LOCTEXT("ExcludedFolder", "The asset is in an excluded directory");
-        return ENamingConventionValidationResult::Excluded;
-    }
+    const bool bRunValidators = bCanUseEditorValidators && HasEnabledValidators();
 
-    FName AssetClassName;
-    if (!TryGetAssetDataRealClass(AssetClassName, AssetData))
-    {
-        ErrorMessage = LOCTEXT("UnknownClass", "The asset is of a class which has not been set up in the settings");
-        return ENamingConventionValidationResult::Unknown;
-    }
+    FNamingConventionAssetValidation Validation;
+    ResolveAssetClass(Validation, AssetData, GetDefault<UNamingConventionValidationSettings>()->bAllowLoadingAssetsToResolveClass);
+    ValidateAssetOffGameThread(Validation, AssetData, bRunValidators);
+    ValidateAssetOnGameThread(Validation, AssetData, bRunValidators);
 
-    return DoesAssetMatchNameConvention(ErrorMessage, AssetData, AssetClassName, bCanUseEditorValidators);
+    ErrorMessage = Validation.Message.ToText();
+    return Validation.Result;
 }
 
 void UEditorNamingValidatorSubsystem::RegisterBlueprintValidators()
 {
+    NAMING_CONVENTION_VALIDATION_SCOPE(STAT_NamingConventionValidation_RegisterValidators);
+
     if (!bAllowBlueprintValidators)
     {
         return;
     }
 
+    // Native classes are always loaded, so the parent class tags of the blueprints are enough to filter the candidates
+    TSet<FTopLevelAssetPath> NativeValidatorClassPaths;
+    NativeValidatorClassPaths.Add(UEditorNamingValidatorBase::StaticClass()->GetClassPathName());
+
+    TArray<UClass*> ValidatorClasses;
+    GetDerivedClasses(UEditorNamingValidatorBase::StaticClass(), ValidatorClasses);
+    for (const UClass* ValidatorClass : ValidatorClasses)
+    {
+        if (ValidatorClass->HasAnyClassFlags(CLASS_Native))
+        {
+            NativeValidatorClassPaths.Add(ValidatorClass->GetClassPathName());
+        }
+    }
+
     // Locate all validators (include unloaded)
     const FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
     TArray<FAssetData> AllBlueprintAssetData;
     AssetRegistryModule.Get().GetAssetsByClass(UEditorUtilityBlueprint::StaticClass()->GetClassPathName(), AllBlueprintAssetData, true);
 
-    for (FAssetData& AssetData : AllBlueprintAssetData)
+    for (const FAssetData& AssetData : AllBlueprintAssetData)
     {
         FString ParentClassName;
 
@@ -255,211 +523,823 @@ void UEditorNamingValidatorSubsystem::RegisterBlueprintValidators()
             AssetData.GetTagValue(FBlueprintTags::ParentClassPath, ParentClassName);
         }
 
-        if (!ParentClassName.IsEmpty())
+        // Blueprints saved without those tags are loaded to find out what they are
+        if (!ParentClassName.IsEmpty() && !NativeValidatorClassPaths.Contains(FTopLevelAssetPath(FPackageName::ExportTextPathToObjectPath(ParentClassName))))
         {
-            UObject* Outer = nullptr;
-            ResolveName(Outer, ParentClassName, false, false);
-            const UClass* ParentClass = FindObject<UClass>(nullptr, *ParentClassName);
-            if (!ParentClass || !ParentClass->IsChildOf(UEditorNamingValidatorBase::StaticClass()))
-            {
-                continue;
-            }
+            continue;
         }
 
-        // If this object isn't currently loaded, load it
-        UObject* ValidatorObject = AssetData.ToSoftObjectPath().ResolveObject();
-        if (ValidatorObject == nullptr)
+        const FSoftObjectPath ValidatorPath = AssetData.ToSoftObjectPath();
+
+        if (UObject* ValidatorObject = ValidatorPath.ResolveObject())
         {
-            ValidatorObject = AssetData.ToSoftObjectPath().TryLoad();
+            AddBlueprintValidator(ValidatorObject);
         }
-        if (ValidatorObject)
+        else if (!PendingBlueprintValidators.Contains(ValidatorPath))
         {
-            const UEditorUtilityBlueprint* ValidatorBlueprint = Cast<UEditorUtilityBlueprint>(ValidatorObject);
-            UEditorNamingValidatorBase* Validator = NewObject< UEditorNamingValidatorBase >(GetTransientPackage(), ValidatorBlueprint->GeneratedClass);
-            AddValidator(Validator);
+            // Added before the request, in case the load completes right away
+            PendingBlueprintValidators.Add(ValidatorPath);
+
+            const TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(ValidatorPath, FStreamableDelegate::CreateUObject(this, &UEditorNamingValidatorSubsystem::OnBlueprintValidatorLoaded, ValidatorPath));
+
+            if (TSharedPtr<FStreamableHandle>* PendingHandle = PendingBlueprintValidators.Find(ValidatorPath))
+            {
+                if (Handle.IsValid())
+                {
+                    *PendingHandle = Handle;
+                }
+                else
+                {
+                    PendingBlueprintValidators.Remove(ValidatorPath);
+                }
+            }
         }
     }
-}
 
-void UEditorNamingValidatorSubsystem::CleanupValidators()
-{
-    Validators.Empty();
+    UE_LOG(LogNamingConventionValidation, Verbose, TEXT("%d blueprint validators are being loaded"), PendingBlueprintValidators.Num());
 }
 
-void UEditorNamingValidatorSubsystem::ValidateAllSavedPackages()
+void UEditorNamingValidatorSubsystem::OnBlueprintValidatorLoaded(const FSoftObjectPath ValidatorPath)
 {
-    const FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    TArray<FAssetData> Assets;
+    NAMING_CONVENTION_VALIDATION_SCOPE(STAT_NamingConventionValidation_RegisterValidators);
 
-    for (const FName& PackageName : SavedPackagesToValidate)
+    // Already registered by WaitForBlueprintValidators, or canceled
+    if (PendingBlueprintValidators.Remove(ValidatorPath) == 0)
     {
-        // We need to query the in-memory data as the disk cache may not be accurate
-        AssetRegistryModule.Get().GetAssetsByPackageName(PackageName, Assets);
+        return;
     }
 
-    ValidateOnSave(Assets);
-
-    SavedPackagesToValidate.Empty();
+    AddBlueprintValidator(ValidatorPath.ResolveObject());
 }
 
-void UEditorNamingValidatorSubsystem::ValidateOnSave(const TArray<FAssetData>& AssetDataList) const
+void UEditorNamingValidatorSubsystem::AddBlueprintValidator(UObject* ValidatorObject)
 {
-    if (ensure(GEditor))
+    const UEditorUtilityBlueprint* ValidatorBlueprint = Cast<UEditorUtilityBlueprint>(ValidatorObject);
+    if (ValidatorBlueprint == nullptr || ValidatorBlueprint->GeneratedClass == nullptr)
     {
-        const UNamingConventionValidationSettings* Settings = GetDefault<UNamingConventionValidationSettings>();
-        if (!Settings->bDoesValidateOnSave || GEditor->IsAutosaving())
-        {
-            return;
-        }
-
-        FMessageLog DataValidationLog("NamingConventionValidation");
+        return;
+    }
 
-        if (ValidateAssets(AssetDataList, true, false) > 0)
-        {
-            const auto ErrorMessageNotification = FText::Format(
-                LOCTEXT("ValidationFailureNotification", "Naming Convention Validation failed when saving {0}, check Naming Convention Validation log"),
-                AssetDataList.Num() == 1 ? FText::FromName(AssetDataList[0].AssetName) : LOCTEXT("MultipleErrors", "multiple assets"));
-            DataValidationLog.Notify(ErrorMessageNotification, EMessageSeverity::Warning, /*bForce=*/true);
-        }
+    UClass* ValidatorClass = ValidatorBlueprint->GeneratedClass;
+    if (ValidatorClass->IsChildOf(UEditorNamingValidatorBase::StaticClass()) && !ValidatorClass->HasAnyClassFlags(CLASS_Abstract))
+    {
+        UEditorNamingValidatorBase* Validator = NewObject< UEditorNamingValidatorBase >(GetTransientPackage(), ValidatorClass);
+        AddValidator(Validator);
     }
 }
 
-ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchNameConvention(FText& ErrorMessage, const FAssetData& AssetData, const FName AssetClass, bool bCanUseEditorValidators) const
+void UEditorNamingValidatorSubsystem::WaitForBlueprintValidators() const
 {
-    static const FTopLevelAssetPath BlueprintGeneratedClassName("/Script/Engine.BlueprintGeneratedClass");
-    static const FTopLevelAssetPath BlueprintClassName("/Script/Engine.Blueprint");
-
-    const UNamingConventionValidationSettings* Settings = GetDefault< UNamingConventionValidationSettings >();
-    FString AssetName = AssetData.AssetName.ToString();
-
-    // Starting UE4.27 (?) some blueprints now have BlueprintGeneratedClass as their AssetClass, and their name ends with a _C.
-    if (AssetData.AssetClassPath == BlueprintGeneratedClassName)
+    if (PendingBlueprintValidators.IsEmpty())
     {
-        AssetName.RemoveFromEnd(TEXT("_C"), ESearchCase::CaseSensitive);
+        return;
     }
 
-    const FSoftClassPath AssetClassPath(AssetClass.ToString());
+    NAMING_CONVENTION_VALIDATION_SCOPE(STAT_NamingConventionValidation_RegisterValidators);
 
-    if (const UClass* AssetRealClass = AssetClassPath.TryLoadClass<UObject>())
-    {
-        if (IsClassExcluded(ErrorMessage, AssetRealClass))
-        {
-            return ENamingConventionValidationResult::Excluded;
-        }
+    // Registering the validators as soon as they are needed, instead of on the next tick, does not change the state seen by the callers
+    UEditorNamingValidatorSubsystem* MutableThis = const_cast<UEditorNamingValidatorSubsystem*>(this);
 
-        ENamingConventionValidationResult Result = ENamingConventionValidationResult::Unknown;
+    TArray<FSoftObjectPath> ValidatorPaths;
+    PendingBlueprintValidators.GenerateKeyArray(ValidatorPaths);
 
-        if (bCanUseEditorValidators)
+    for (const FSoftObjectPath& ValidatorPath : ValidatorPaths)
+    {
+        // Waiting for a load can complete other ones
+        const TSharedPtr<FStreamableHandle> Handle = PendingBlueprintValidators.FindRef(ValidatorPath);
+        if (!Handle.IsValid())
         {
-            Result = DoesAssetMatchesValidators(ErrorMessage, AssetRealClass, AssetData);
-            if (Result != ENamingConventionValidationResult::Unknown)
-            {
-                return Result;
-            }
+            continue;
         }
 
-        Result = DoesAssetMatchesClassDescriptions(ErrorMessage, AssetRealClass, AssetName);
-        if (Result != ENamingConventionValidationResult::Unknown)
-        {
-            return Result;
-        }
+        Handle->WaitUntilComplete();
+        MutableThis->OnBlueprintValidatorLoaded(ValidatorPath);
     }
+}
 
-    if (AssetData.AssetClassPath == BlueprintClassName || AssetData.AssetClassPath == BlueprintGeneratedClassName)
+void UEditorNamingValidatorSubsystem::CleanupValidators()
+{
+    for (const TPair<FSoftObjectPath, TSharedPtr<FStreamableHandle>>& PendingValidator : PendingBlueprintValidators)
     {
-        if (!AssetName.StartsWith(Settings->BlueprintsPrefix))
-        {
-            ErrorMessage = FText::FromString(TEXT("Generic blueprint assets must start with BP_"));
-            return ENamingConventionValidationResult::Invalid;
-        }
-
-        return ENamingConventionValidationResult::Valid;
+        PendingValidator.Value->CancelHandle();
     }
 
-    return ENamingConventionValidationResult::Unknown;
+    PendingBlueprintValidators.Empty();
+    Validators.Empty();
+    ValidatorsByAssetClass.Reset();
 }
 
-bool UEditorNamingValidatorSubsystem::IsClassExcluded(FText& ErrorMessage, const UClass* AssetClass) const
+void UEditorNamingValidatorSubsystem::OnAssetAdded(const FAssetData& AssetData)
 {
-    const UNamingConventionValidationSettings* Settings = GetDefault<UNamingConventionValidationSettings>();
+    InvalidateClassAncestryIndex(AssetData);
 
-    for (const UClass* ExcludedClass : Settings->ExcludedClasses)
+    if (GetDefault<UNamingConventionValidationSettings>()->bEnableLiveValidation)
     {
-        if (AssetClass->IsChildOf(ExcludedClass))
-        {
-            ErrorMessage = FText::Format(LOCTEXT("ExcludedClass", "Assets of class '{0}' are excluded from naming convention validation"), FText::FromString(ExcludedClass->GetDefaultObjectName().ToString()));
-            return true;
-        }
+        LiveAssetsToValidate.Add(AssetData.GetSoftObjectPath(), AssetData);
     }
-
-    return false;
 }
 
-ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchesClassDescriptions(FText& ErrorMessage, const UClass* AssetClass, const FString& AssetName) const
+void UEditorNamingValidatorSubsystem::OnAssetRemoved(const FAssetData& AssetData)
 {
-    const UNamingConventionValidationSettings* Settings = GetDefault<UNamingConventionValidationSettings>();
-    UClass* MostPreciseClass = UObject::StaticClass();
-    ENamingConventionValidationResult Result = ENamingConventionValidationResult::Unknown;
+    InvalidateClassAncestryIndex(AssetData);
 
-    for (const FNamingConventionValidationClassDescription& ClassDescription : Settings->ClassDescriptions)
-    {
-        if (!IsValid(ClassDescription.Class))
-            continue;
+    const FSoftObjectPath AssetPath = AssetData.GetSoftObjectPath();
+    LiveAssetsToValidate.Remove(AssetPath);
+    ViolationIndex.Remove(AssetPath);
 
-        const bool bClassFilterMatches = AssetClass->IsChildOf(ClassDescription.Class);
-        const bool bClassIsMoreOrSamePrecise = ClassDescription.Class->IsChildOf(MostPreciseClass);
-        const bool bClassIsSamePrecise = bClassIsMoreOrSamePrecise && ClassDescription.Class == MostPreciseClass;
-        const bool bClassIsMorePrecise = bClassIsMoreOrSamePrecise && ClassDescription.Class != MostPreciseClass;
-        // had an error on this precision level before. but there could be another filter that passes
-        const bool bSamePrecisionCanBeValid = bClassIsSamePrecise && Result != ENamingConventionValidationResult::Valid;
+    if (LiveValidationBatch.IsValid())
+    {
+        LiveValidationBatch->RemovedAssets.Add(AssetPath);
+    }
+}
 
-        const bool bCheckAffixes = bClassFilterMatches && (bClassIsMorePrecise || bSamePrecisionCanBeValid);
-        if (bCheckAffixes)
-        {
-            MostPreciseClass = ClassDescription.Class;
+void UEditorNamingValidatorSubsystem::OnAssetUpdated(const FAssetData& AssetData) const
+{
+    InvalidateClassAncestryIndex(AssetData);
+}
 
-            ErrorMessage = FText::GetEmpty();
-            Result = ENamingConventionValidationResult::Valid;
+void UEditorNamingValidatorSubsystem::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    InvalidateClassAncestryIndex(AssetData);
 
-            if (!ClassDescription.Prefix.IsEmpty())
-            {
-                if (!AssetName.StartsWith(ClassDescription.Prefix))
-                {
-                    ErrorMessage = FText::Format(LOCTEXT("WrongPrefix", "Assets of class '{0}' must have a name which starts with {1}"), FText::FromString(ClassDescription.ClassPath.ToString()), FText::FromString(ClassDescription.Prefix));
-                    Result = ENamingConventionValidationResult::Invalid;
-                }
-            }
+    const FSoftObjectPath OldAssetPath(OldObjectPath);
+    LiveAssetsToValidate.Remove(OldAssetPath);
 
-            if (!ClassDescription.Suffix.IsEmpty())
-            {
-                if (!AssetName.EndsWith(ClassDescription.Suffix))
-                {
-                    ErrorMessage = FText::Format(LOCTEXT("WrongSuffix", "Assets of class '{0}' must have a name which ends with {1}"), FText::FromString(ClassDescription.ClassPath.ToString()), FText::FromString(ClassDescription.Suffix));
-                    Result = ENamingConventionValidationResult::Invalid;
-                }
-            }
-        }
+    if (LiveValidationBatch.IsValid())
+    {
+        LiveValidationBatch->RemovedAssets.Add(OldAssetPath);
     }
 
-    return Result;
+    // The violations of renamed assets are validated again, even when the live validation is disabled
+    const bool bHadViolation = ViolationIndex.Contains(OldAssetPath);
+    ViolationIndex.Remove(OldAssetPath);
+
+    if (bHadViolation || GetDefault<UNamingConventionValidationSettings>()->bEnableLiveValidation)
+    {
+        LiveAssetsToValidate.Add(AssetData.GetSoftObjectPath(), AssetData);
+    }
 }
 
-ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchesValidators(FText& ErrorMessage, const UClass* AssetClass, const FAssetData& AssetData) const
+void UEditorNamingValidatorSubsystem::InvalidateClassAncestryIndex(const FAssetData& AssetData) const
 {
-    for (const TPair<UClass*, UEditorNamingValidatorBase*>& ValidatorPair : Validators)
+    // Only blueprints add classes to the hierarchy known by the registry
+    if (AssetData.TagsAndValues.Contains(FBlueprintTags::GeneratedClassPath))
     {
-        if (ValidatorPair.Value != nullptr && ValidatorPair.Value->IsEnabled() && ValidatorPair.Value->CanValidateAssetNaming(AssetClass, AssetData))
-        {
-            const ENamingConventionValidationResult Result = ValidatorPair.Value->ValidateAssetNaming(ErrorMessage, AssetClass, AssetData);
+        GetDefault<UNamingConventionValidationSettings>()->InvalidateClassAncestryIndex();
+    }
+}
+
+bool UEditorNamingValidatorSubsystem::TickLiveValidation(float /*DeltaTime*/)
+{
+    if (LiveValidationBatch.IsValid())
+    {
+        if (!LiveValidationBatch->Task.IsCompleted())
+        {
+            return true;
+        }
+
+        const bool bRunValidators = HasEnabledValidators();
+
+        for (int32 Index = 0; Index < LiveValidationBatch->Assets.Num(); ++Index)
+        {
+            const FAssetData& AssetData = LiveValidationBatch->Assets[Index];
+            FNamingConventionAssetValidation& Validation = LiveValidationBatch->Validations[Index];
+
+            const FSoftObjectPath AssetPath = AssetData.GetSoftObjectPath();
+            if (LiveValidationBatch->RemovedAssets.Contains(AssetPath))
+            {
+                continue;
+            }
+
+            // The rules result is kept when the class needed by the editor validators has been collected
+            if (Validation.GameThreadStage == FNamingConventionAssetValidation::EGameThreadStage::Validators)
+            {
+                Validation.AssetClass = LiveValidationBatch->AssetClasses[Index].Get();
+
+                if (Validation.AssetClass == nullptr)
+                {
+                    Validation.GameThreadStage = FNamingConventionAssetValidation::EGameThreadStage::None;
+                }
+            }
+
+            ValidateAssetOnGameThread(Validation, AssetData, bRunValidators);
+
+            // Deferred results do not tell whether the asset has been fixed
+            if (Validation.Result != ENamingConventionValidationResult::Deferred)
+            {
+                ViolationIndex.Update(AssetData, Validation.Result, Validation.Message);
+            }
+        }
+
+        LiveValidationBatch.Reset();
+    }
+
+    // The assets found by a scan of the registry are validated once it is over, so the class ancestry index is only built once
+    if (LiveAssetsToValidate.IsEmpty() || IAssetRegistry::GetChecked().IsLoadingAssets())
+    {
+        return true;
+    }
+
+    GetDefault<UNamingConventionValidationSettings>()->UpdateClassAncestryIndex();
+
+    LiveValidationBatch = MakeShared<FNamingConventionLiveValidationBatch>();
+
+    for (auto AssetIt = LiveAssetsToValidate.CreateIterator(); AssetIt && LiveValidationBatch->Assets.Num() < FNamingConventionLiveValidationBatch::MaxNumAssets; ++AssetIt)
+    {
+        LiveValidationBatch->Assets.Add(MoveTemp(AssetIt.Value()));
+        AssetIt.RemoveCurrent();
+    }
+
+    LiveValidationBatch->Validations.SetNum(LiveValidationBatch->Assets.Num());
+    LiveValidationBatch->AssetClasses.Reserve(LiveValidationBatch->Assets.Num());
+
+    // The objects are only looked up here, as the game thread may collect garbage or save packages while the task runs
+    for (int32 Index = 0; Index < LiveValidationBatch->Assets.Num(); ++Index)
+    {
+        FNamingConventionAssetValidation& Validation = LiveValidationBatch->Validations[Index];
+        // The live validation never loads anything
+        ResolveAssetClass(Validation, LiveValidationBatch->Assets[Index], false);
+        LiveValidationBatch->AssetClasses.Add(Validation.AssetNativeClass != nullptr ? Validation.AssetNativeClass : Validation.AssetRealClass);
+    }
+
+    const bool bRunValidators = HasEnabledValidators();
+    LiveValidationBatch->Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, Batch = LiveValidationBatch.ToSharedRef(), bRunValidators]() {
+        ParallelFor(Batch->Assets.Num(), [this, &Batch, bRunValidators](const int32 Index) {
+            ValidateAssetOffGameThread(Batch->Validations[Index], Batch->Assets[Index], bRunValidators);
+        });
+    });
+
+    return true;
+}
+
+void UEditorNamingValidatorSubsystem::WaitForLiveValidationBatch() const
+{
+    if (LiveValidationBatch.IsValid())
+    {
+        LiveValidationBatch->Task.Wait();
+    }
+}
+
+void UEditorNamingValidatorSubsystem::CancelLiveValidationBatch()
+{
+    if (!LiveValidationBatch.IsValid())
+    {
+        return;
+    }
+
+    LiveValidationBatch->Task.Wait();
+
+    for (FAssetData& AssetData : LiveValidationBatch->Assets)
+    {
+        FSoftObjectPath AssetPath = AssetData.GetSoftObjectPath();
+        if (!LiveValidationBatch->RemovedAssets.Contains(AssetPath))
+        {
+            LiveAssetsToValidate.Add(MoveTemp(AssetPath), MoveTemp(AssetData));
+        }
+    }
+
+    LiveValidationBatch.Reset();
+}
+
+void UEditorNamingValidatorSubsystem::OnSettingsChanging()
+{
+    CancelLiveValidationBatch();
+
+    // The violations keep the messages they were found with until the assets are validated again
+    ViolationIndex.ResolveMessages();
+}
+
+const FNamingConventionViolationIndex& UEditorNamingValidatorSubsystem::GetViolationIndex() const
+{
+    return ViolationIndex;
+}
+
+void UEditorNamingValidatorSubsystem::ValidateAllSavedPackages()
+{
+    NAMING_CONVENTION_VALIDATION_SCOPE(STAT_NamingConventionValidation_ValidateOnSave);
+
+    ValidateSavedPackagesTimerHandle.Invalidate();
+
+    if (SavedPackagesToValidate.IsEmpty())
+    {
+        return;
+    }
+
+    // We need to query the in-memory data as the disk cache may not be accurate
+    FARFilter Filter;
+    Filter.PackageNames = SavedPackagesToValidate.Array();
+
+    const FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+    AssetRegistryModule.Get().GetAssets(Filter, SavedAssetsToValidate);
+
+    SavedPackagesToValidate.Reset();
+
+    // Packages saved while the previous ones are still being validated join the same report
+    if (!SavedAssetsReportSink.IsValid())
+    {
+        ValidateSavedAssetsTimeSlice();
+    }
+}
+
+void UEditorNamingValidatorSubsystem::ValidateSavedAssetsTimeSlice()
+{
+    NAMING_CONVENTION_VALIDATION_SCOPE(STAT_NamingConventionValidation_ValidateOnSave);
+
+    const UNamingConventionValidationSettings* Settings = GetDefault<UNamingConventionValidationSettings>();
+    if (!Settings->bDoesValidateOnSave || !ensure(GEditor))
+    {
+        SavedAssetsToValidate.Reset();
+        NextSavedAssetIndex = 0;
+        SavedAssetsReportSink.Reset();
+        return;
+    }
+
+    if (!SavedAssetsReportSink.IsValid())
+    {
+        SavedAssetsReportSink = MakeShared<FNamingConventionValidationMergedReportSink>(MakeUnique<FNamingConventionValidationMessageLogSink>(false));
+        SavedAssetsReportSink->BeginMergedReport();
+    }
+
+    const int32 NumAssets = FMath::Min(SavedAssetsTimeSliceSize, SavedAssetsToValidate.Num() - NextSavedAssetIndex);
+    const TArray<FAssetData> TimeSliceAssets(MakeArrayView(SavedAssetsToValidate).Mid(NextSavedAssetIndex, NumAssets));
+    NextSavedAssetIndex += NumAssets;
+
+    FNamingConventionValidationOptions Options;
+    Options.bShowIfNoFailures = false;
+    Options.bUseMessageLog = false;
+    Options.ReportSinks.Add(SavedAssetsReportSink.Get());
+
+    const double StartTime = FPlatformTime::Seconds();
+    ValidateAssets(TimeSliceAssets, Options);
+    const double SecondsPerAsset = (FPlatformTime::Seconds() - StartTime) / FMath::Max(NumAssets, 1);
+
+    // The next time slice is sized from the cost of this one
+    SavedAssetsTimeSliceSize = static_cast<int32>(FMath::Clamp(Settings->ValidateOnSaveTimeSliceSeconds / FMath::Max(SecondsPerAsset, UE_SMALL_NUMBER), 1.0, 65536.0));
+
+    if (NextSavedAssetIndex < SavedAssetsToValidate.Num())
+    {
+        GEditor->GetTimerManager()->SetTimerForNextTick(this, &UEditorNamingValidatorSubsystem::ValidateSavedAssetsTimeSlice);
+        return;
+    }
+
+    SavedAssetsReportSink->EndMergedReport();
+
+    if (SavedAssetsReportSink->GetSummary().NumInvalidFiles > 0)
+    {
+        const auto ErrorMessageNotification = FText::Format(
+            LOCTEXT("ValidationFailureNotification", "Naming Convention Validation failed when saving {0}, check Naming Convention Validation log"),
+            SavedAssetsToValidate.Num() == 1 ? FText::FromName(SavedAssetsToValidate[0].AssetName) : LOCTEXT("MultipleErrors", "multiple assets"));
+
+        FMessageLog DataValidationLog("NamingConventionValidation");
+        DataValidationLog.Notify(ErrorMessageNotification, EMessageSeverity::Warning, /*bForce=*/true);
+    }
+
+    SavedAssetsToValidate.Reset();
+    NextSavedAssetIndex = 0;
+    SavedAssetsReportSink.Reset();
+}
+
+void UEditorNamingValidatorSubsystem::ResolveAssetClass(FNamingConventionAssetValidation& Validation, const FAssetData& AssetData, const bool bAllowLoading) const
+{
+    Validation.bAllowLoading = bAllowLoading;
+
+    FName AssetNativeClassName;
+    const bool bIsNativeClassResolved = TryGetAssetDataRealClass(AssetNativeClassName, AssetData, false) == EAssetClassResolution::Resolved;
+
+    if (bIsNativeClassResolved)
+    {
+        Validation.AssetNativeClass = FSoftClassPath(AssetNativeClassName.ToString()).ResolveClass();
+    }
+
+    // Without loading, both resolutions are the same
+    if (!bAllowLoading)
+    {
+        Validation.AssetClassName = bIsNativeClassResolved ? AssetNativeClassName : NAME_None;
+        Validation.AssetRealClass = Validation.AssetNativeClass;
+        Validation.bRealClassRequiresLoad = !bIsNativeClassResolved;
+        return;
+    }
+
+    Validation.bRealClassRequiresLoad = TryGetAssetDataRealClass(Validation.AssetClassName, AssetData, true) == EAssetClassResolution::RequiresLoad;
+
+    if (!Validation.bRealClassRequiresLoad)
+    {
+        Validation.AssetRealClass = FSoftClassPath(Validation.AssetClassName.ToString()).ResolveClass();
+    }
+}
+
+void UEditorNamingValidatorSubsystem::ValidateAssetOffGameThread(FNamingConventionAssetValidation& Validation, const FAssetData& AssetData, const bool bRunValidators) const
+{
+    const UNamingConventionValidationSettings* Settings = GetDefault<UNamingConventionValidationSettings>();
+
+    bool bIsPathExcluded = false;
+    {
+        NAMING_CONVENTION_VALIDATION_SCOPE(STAT_NamingConventionValidation_PathExclusion);
+        bIsPathExcluded = Settings->IsPathExcludedFromValidation(AssetData.PackageName);
+    }
+
+    if (bIsPathExcluded)
+    {
+        Validation.Message = FNamingConventionValidationMessage(ENamingConventionValidationRule::ExcludedDirectory);
+        Validation.Result = ENamingConventionValidationResult::Excluded;
+        return;
+    }
+
+    // The class path of the asset is matched through the class hierarchy of the registry, so blueprint classes never have to be loaded
+    const FTopLevelAssetPath AssetClassPath = GetAssetClassPath(AssetData);
+    if (AssetClassPath.IsValid())
+    {
+        const UClass* AssetNativeClass = Validation.AssetNativeClass;
+
+        FNamingConventionValidationClassVerdict ClassVerdict = Settings->GetClassVerdict(AssetClassPath);
+        const bool bHasClassRules = !ClassVerdict.IsEmpty();
+
+        // The registry does not know the hierarchy of blueprints whose parent is missing
+        if (!bHasClassRules && AssetNativeClass != nullptr)
+        {
+            ClassVerdict = Settings->GetClassVerdict(AssetNativeClass);
+        }
+
+        // Otherwise the class is loaded below, either because the registry does not know it or because the editor validators need it
+        if (AssetNativeClass != nullptr || (bHasClassRules && !bRunValidators))
+        {
+            DoesAssetMatchNameConvention(Validation, AssetData, &ClassVerdict, AssetNativeClass, bRunValidators);
+            return;
+        }
+    }
+
+    // Either the asset or its class would have to be loaded
+    if (Validation.bRealClassRequiresLoad || Validation.AssetRealClass == nullptr)
+    {
+        if (!Validation.bAllowLoading)
+        {
+            Validation.Message = FNamingConventionValidationMessage(ENamingConventionValidationRule::Deferred);
+            Validation.Result = ENamingConventionValidationResult::Deferred;
+            return;
+        }
+
+        Validation.GameThreadStage = FNamingConventionAssetValidation::EGameThreadStage::Load;
+        return;
+    }
+
+    const FNamingConventionValidationClassVerdict ClassVerdict = Settings->GetClassVerdict(Validation.AssetRealClass);
+    DoesAssetMatchNameConvention(Validation, AssetData, &ClassVerdict, Validation.AssetRealClass, bRunValidators);
+}
+
+void UEditorNamingValidatorSubsystem::ValidateAssetOnGameThread(FNamingConventionAssetValidation& Validation, const FAssetData& AssetData, const bool bRunValidators) const
+{
+    check(IsInGameThread());
+
+    if (Validation.GameThreadStage == FNamingConventionAssetValidation::EGameThreadStage::Load)
+    {
+        Validation.GameThreadStage = FNamingConventionAssetValidation::EGameThreadStage::None;
+
+        if (Validation.AssetClassName.IsNone() && !TryLoadAssetDataRealClass(Validation.AssetClassName, AssetData))
+        {
+            Validation.Message = FNamingConventionValidationMessage(ENamingConventionValidationRule::UnknownClass);
+            Validation.Result = ENamingConventionValidationResult::Unknown;
+            return;
+        }
+
+        const UClass* AssetRealClass = nullptr;
+        {
+            NAMING_CONVENTION_VALIDATION_SCOPE(STAT_NamingConventionValidation_ClassLoad);
+
+            const FSoftClassPath ClassPath(Validation.AssetClassName.ToString());
+            AssetRealClass = ClassPath.ResolveClass();
+            if (AssetRealClass == nullptr)
+            {
+                AssetRealClass = ClassPath.TryLoadClass<UObject>();
+                if (AssetRealClass != nullptr)
+                {
+                    INC_DWORD_STAT(STAT_NamingConventionValidation_ClassesLoaded);
+                    TRACE_COUNTER_INCREMENT(NamingConventionValidation_ClassesLoaded);
+                }
+            }
+        }
+
+        if (AssetRealClass != nullptr)
+        {
+            const FNamingConventionValidationClassVerdict ClassVerdict = GetDefault<UNamingConventionValidationSettings>()->GetClassVerdict(AssetRealClass);
+            DoesAssetMatchNameConvention(Validation, AssetData, &ClassVerdict, AssetRealClass, bRunValidators);
+        }
+        else
+        {
+            DoesAssetMatchNameConvention(Validation, AssetData, nullptr, nullptr, bRunValidators);
+        }
+    }
+
+    if (Validation.GameThreadStage == FNamingConventionAssetValidation::EGameThreadStage::Validators)
+    {
+        Validation.GameThreadStage = FNamingConventionAssetValidation::EGameThreadStage::None;
 
+        FText ValidatorErrorMessage;
+        const ENamingConventionValidationResult Result = DoesAssetMatchesValidators(ValidatorErrorMessage, Validation.AssetClass, AssetData);
+        if (Result != ENamingConventionValidationResult::Unknown)
+        {
+            Validation.Message = FNamingConventionValidationMessage(ENamingConventionValidationRule::Validator);
+            Validation.Message.Text = ValidatorErrorMessage;
+            Validation.Result = Result;
+        }
+    }
+}
+
+void UEditorNamingValidatorSubsystem::DoesAssetMatchNameConvention(FNamingConventionAssetValidation& Validation, const FAssetData& AssetData, const FNamingConventionValidationClassVerdict* ClassVerdict, const UClass* AssetClass, const bool bRunValidators) const
+{
+    Validation.Result = DoesAssetMatchRules(Validation.Message, AssetData, ClassVerdict);
+
+    // The editor validators take precedence over the rules, but they can only run on the game thread.
+    // The result of the rules is kept in case none of the validators gives a verdict.
+    if (ClassVerdict != nullptr && Validation.Result != ENamingConventionValidationResult::Excluded && bRunValidators && AssetClass != nullptr)
+    {
+        Validation.AssetClass = AssetClass;
+        Validation.GameThreadStage = FNamingConventionAssetValidation::EGameThreadStage::Validators;
+    }
+}
+
+FTopLevelAssetPath UEditorNamingValidatorSubsystem::GetAssetClassPath(const FAssetData& AssetData)
+{
+    static const FTopLevelAssetPath BlueprintGeneratedClassName("/Script/Engine.BlueprintGeneratedClass");
+
+    if (AssetData.AssetClassPath == BlueprintGeneratedClassName)
+    {
+        return FTopLevelAssetPath(AssetData.PackageName, AssetData.AssetName);
+    }
+
+    FString GeneratedClassName;
+    if (AssetData.GetTagValue(FBlueprintTags::GeneratedClassPath, GeneratedClassName))
+    {
+        return FTopLevelAssetPath(FPackageName::ExportTextPathToObjectPath(GeneratedClassName));
+    }
+
+    return AssetData.AssetClassPath;
+}
+
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchRules(FNamingConventionValidationMessage& Message, const FAssetData& AssetData, const FNamingConventionValidationClassVerdict* ClassVerdict)
+{
+    static const FTopLevelAssetPath BlueprintGeneratedClassName("/Script/Engine.BlueprintGeneratedClass");
+    static const FTopLevelAssetPath BlueprintClassName("/Script/Engine.Blueprint");
+
+    const UNamingConventionValidationSettings* Settings = GetDefault< UNamingConventionValidationSettings >();
+    FString AssetName = AssetData.AssetName.ToString();
+
+    // Starting UE4.27 (?) some blueprints now have BlueprintGeneratedClass as their AssetClass, and their name ends with a _C.
+    if (AssetData.AssetClassPath == BlueprintGeneratedClassName)
+    {
+        AssetName.RemoveFromEnd(TEXT("_C"), ESearchCase::CaseSensitive);
+    }
+
+    const int32 FolderRuleIndex = Settings->FindFolderRuleIndex(AssetData.PackageName);
+    const bool bIgnoreClassDescriptions = FolderRuleIndex != INDEX_NONE && Settings->FolderRules[FolderRuleIndex].bIgnoreClassDescriptions;
+
+    ENamingConventionValidationResult Result = ENamingConventionValidationResult::Unknown;
+
+    if (ClassVerdict != nullptr)
+    {
+        if (IsClassExcluded(Message, *ClassVerdict))
+        {
+            return ENamingConventionValidationResult::Excluded;
+        }
+
+        if (!bIgnoreClassDescriptions)
+        {
+            Result = DoesAssetMatchesClassDescriptions(Message, *ClassVerdict, AssetName);
             if (Result != ENamingConventionValidationResult::Unknown)
             {
+                DoesAssetMatchFolderRule(Message, Result, FolderRuleIndex, AssetName);
                 return Result;
             }
         }
     }
 
+    if (bIgnoreClassDescriptions)
+    {
+        Message = FNamingConventionValidationMessage();
+        Result = ENamingConventionValidationResult::Valid;
+        DoesAssetMatchFolderRule(Message, Result, FolderRuleIndex, AssetName);
+        return Result;
+    }
+
+    if (AssetData.AssetClassPath == BlueprintClassName || AssetData.AssetClassPath == BlueprintGeneratedClassName)
+    {
+        if (!AssetName.StartsWith(Settings->BlueprintsPrefix))
+        {
+            Message = FNamingConventionValidationMessage(ENamingConventionValidationRule::BlueprintPrefix);
+            return ENamingConventionValidationResult::Invalid;
+        }
+
+        Result = ENamingConventionValidationResult::Valid;
+        DoesAssetMatchFolderRule(Message, Result, FolderRuleIndex, AssetName);
+        return Result;
+    }
+
+    Message = FNamingConventionValidationMessage(ENamingConventionValidationRule::UnknownClass);
     return ENamingConventionValidationResult::Unknown;
 }
 
+bool UEditorNamingValidatorSubsystem::IsClassExcluded(FNamingConventionValidationMessage& Message, const FNamingConventionValidationClassVerdict& ClassVerdict)
+{
+    if (ClassVerdict.ExcludedClassIndex != INDEX_NONE)
+    {
+        Message = FNamingConventionValidationMessage(ENamingConventionValidationRule::ExcludedClass, ClassVerdict.ExcludedClassIndex);
+        return true;
+    }
+
+    return false;
+}
+
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchesClassDescriptions(FNamingConventionValidationMessage& Message, const FNamingConventionValidationClassVerdict& ClassVerdict, const FString& AssetName)
+{
+    NAMING_CONVENTION_VALIDATION_SCOPE(STAT_NamingConventionValidation_ClassDescriptions);
+
+    const UNamingConventionValidationSettings* Settings = GetDefault<UNamingConventionValidationSettings>();
+    ENamingConventionValidationResult Result = ENamingConventionValidationResult::Unknown;
+
+    // Descriptions of the same class are alternatives: the asset is valid as soon as one of them matches
+    for (const int32 DescriptionIndex : ClassVerdict.ClassDescriptionIndices)
+    {
+        const FNamingConventionValidationClassDescriptionMatchers& Matchers = Settings->GetClassDescriptionMatchers(DescriptionIndex);
+
+        Message = FNamingConventionValidationMessage();
+        Result = ENamingConventionValidationResult::Valid;
+
+        if (!Matchers.Prefix.IsEmpty())
+        {
+            if (Matchers.Prefix.FindMatch(AssetName) == INDEX_NONE)
+            {
+                Message = FNamingConventionValidationMessage(ENamingConventionValidationRule::WrongPrefix, DescriptionIndex);
+                Result = ENamingConventionValidationResult::Invalid;
+            }
+        }
+
+        if (!Matchers.Suffix.IsEmpty())
+        {
+            if (Matchers.Suffix.FindMatch(AssetName) == INDEX_NONE)
+            {
+                Message = FNamingConventionValidationMessage(ENamingConventionValidationRule::WrongSuffix, DescriptionIndex);
+                Result = ENamingConventionValidationResult::Invalid;
+            }
+        }
+
+        // The pattern is the most expensive check, it only runs for the names which pass the other ones
+        if (Result == ENamingConventionValidationResult::Valid && !Matchers.Pattern.Matches(AssetName))
+        {
+            Message = FNamingConventionValidationMessage(ENamingConventionValidationRule::WrongPattern, DescriptionIndex);
+            Result = ENamingConventionValidationResult::Invalid;
+        }
+
+        if (Result == ENamingConventionValidationResult::Valid)
+        {
+            break;
+        }
+    }
+
+    return Result;
+}
+
+void UEditorNamingValidatorSubsystem::DoesAssetMatchFolderRule(FNamingConventionValidationMessage& Message, ENamingConventionValidationResult& Result, const int32 FolderRuleIndex, const FString& AssetName)
+{
+    if (FolderRuleIndex == INDEX_NONE || Result != ENamingConventionValidationResult::Valid)
+    {
+        return;
+    }
+
+    const FNamingConventionTokenMatcher& KeywordMatcher = GetDefault<UNamingConventionValidationSettings>()->GetFolderRuleKeywordMatcher(FolderRuleIndex);
+    if (!KeywordMatcher.IsEmpty() && !KeywordMatcher.ContainsAny(AssetName))
+    {
+        Message = FNamingConventionValidationMessage(ENamingConventionValidationRule::FolderKeyword, FolderRuleIndex);
+        Result = ENamingConventionValidationResult::Invalid;
+    }
+}
+
+ENamingConventionValidationResult UEditorNamingValidatorSubsystem::DoesAssetMatchesValidators(FText& ErrorMessage, const UClass* AssetClass, const FAssetData& AssetData) const
+{
+    NAMING_CONVENTION_VALIDATION_SCOPE(STAT_NamingConventionValidation_Validators);
+
+    WaitForBlueprintValidators();
+
+    // The validators demoted for exceeding their time budget only run when none of the other ones gives a verdict
+    for (const bool bRunDemotedValidators : { false, true })
+    {
+        for (UEditorNamingValidatorBase* Validator : GetValidatorsForClass(AssetClass))
+        {
+            if (!Validator->IsEnabled() || !Validator->SupportsPackageName(AssetData.PackageName))
+            {
+                continue;
+            }
+
+            FNamingConventionValidatorStats& Stats = ValidatorStats.FindOrAdd(Validator->GetClass());
+            if (Stats.bIsDisabled || Stats.bIsDemoted != bRunDemotedValidators)
+            {
+                continue;
+            }
+
+            if (Stats.ValidatorName.IsEmpty())
+            {
+                Stats.ValidatorName = Validator->GetClass()->GetName();
+            }
+
+            // The name of the validator is only passed when the trace channel is enabled
+            TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(UE_TRACE_CHANNELEXPR_IS_ENABLED(NamingConventionValidationChannel) ? *Stats.ValidatorName : TEXT(""), NamingConventionValidationChannel);
+
+            ENamingConventionValidationResult Result = ENamingConventionValidationResult::Unknown;
+            const double StartTime = FPlatformTime::Seconds();
+
+            ++Stats.NumCalls;
+            if (Validator->CanValidateAssetNaming(AssetClass, AssetData))
+            {
+                ++Stats.NumValidations;
+                Result = Validator->ValidateAssetNaming(ErrorMessage, AssetClass, AssetData);
+            }
+
+            AddValidatorTime(Stats, *Validator, FPlatformTime::Seconds() - StartTime);
+
+            if (Result != ENamingConventionValidationResult::Unknown)
+            {
+                ++Stats.NumVerdicts;
+                return Result;
+            }
+        }
+    }
+
+    return ENamingConventionValidationResult::Unknown;
+}
+
+const TArray<UEditorNamingValidatorBase*>& UEditorNamingValidatorSubsystem::GetValidatorsForClass(const UClass* AssetClass) const
+{
+    if (const TArray<UEditorNamingValidatorBase*>* ClassValidators = ValidatorsByAssetClass.Find(AssetClass))
+    {
+        return *ClassValidators;
+    }
+
+    TArray<UEditorNamingValidatorBase*> ClassValidators;
+
+    for (const TPair<UClass*, UEditorNamingValidatorBase*>& ValidatorPair : Validators)
+    {
+        if (ValidatorPair.Value != nullptr && ValidatorPair.Value->SupportsAssetClass(AssetClass))
+        {
+            ClassValidators.Add(ValidatorPair.Value);
+        }
+    }
+
+    return ValidatorsByAssetClass.Add(AssetClass, MoveTemp(ClassValidators));
+}
+
+void UEditorNamingValidatorSubsystem::AddValidatorTime(FNamingConventionValidatorStats& Stats, const UEditorNamingValidatorBase& Validator, const double Seconds) const
+{
+    Stats.TotalSeconds += Seconds;
+    Stats.MaxSeconds = FMath::Max(Stats.MaxSeconds, Seconds);
+
+    const UNamingConventionValidationSettings* Settings = GetDefault<UNamingConventionValidationSettings>();
+    const double TimeBudgetSeconds = Validator.GetTimeBudgetSeconds() > 0.0f ? Validator.GetTimeBudgetSeconds() : Settings->ValidatorTimeBudgetSeconds;
+
+    if (TimeBudgetSeconds <= 0.0 || Stats.TotalSeconds <= TimeBudgetSeconds)
+    {
+        return;
+    }
+
+    if (Settings->ValidatorBudgetExceededAction == ENamingConventionValidatorBudgetAction::Disable)
+    {
+        Stats.bIsDisabled = true;
+        bHasDisabledValidators = true;
+        UE_LOG(LogNamingConventionValidation, Warning, TEXT("Validator %s spent %.2f s, more than its budget of %.2f s. It is disabled until the end of the validation"), *Stats.ValidatorName, Stats.TotalSeconds, TimeBudgetSeconds);
+    }
+    else if (!Stats.bIsDemoted)
+    {
+        Stats.bIsDemoted = true;
+        UE_LOG(LogNamingConventionValidation, Warning, TEXT("Validator %s spent %.2f s, more than its budget of %.2f s. It now runs after the other validators"), *Stats.ValidatorName, Stats.TotalSeconds, TimeBudgetSeconds);
+    }
+}
+
+TArray<FNamingConventionValidatorStats> UEditorNamingValidatorSubsystem::GetValidatorStats() const
+{
+    TArray<FNamingConventionValidatorStats> Stats;
+    ValidatorStats.GenerateValueArray(Stats);
+
+    Stats.Sort([](const FNamingConventionValidatorStats& Lhs, const FNamingConventionValidatorStats& Rhs) {
+        return Lhs.TotalSeconds > Rhs.TotalSeconds;
+    });
+
+    return Stats;
+}
+
+bool UEditorNamingValidatorSubsystem::HasEnabledValidators() const
+{
+    // Blueprint validators still being loaded are enabled by default
+    if (!PendingBlueprintValidators.IsEmpty())
+    {
+        return true;
+    }
+
+    for (const TPair<UClass*, UEditorNamingValidatorBase*>& ValidatorPair : Validators)
+    {
+        if (ValidatorPair.Value != nullptr && ValidatorPair.Value->IsEnabled())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 #undef LOCTEXT_NAMESPACE
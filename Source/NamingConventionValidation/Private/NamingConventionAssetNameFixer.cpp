@@ -0,0 +1,274 @@
+#include "NamingConventionAssetNameFixer.h"
+
+#include "EditorNamingValidatorSubsystem.h"
+#include "NamingConventionValidationLog.h"
+#include "NamingConventionValidationReport.h"
+#include "NamingConventionValidationSettings.h"
+
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "AssetToolsModule.h"
+#include "Editor.h"
+#include "FileHelpers.h"
+#include "IAssetTools.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopedSlowTask.h"
+#include "UObject/ObjectRedirector.h"
+
+#define LOCTEXT_NAMESPACE "NamingConventionValidationManager"
+
+namespace NamingConventionAssetNameFixer
+{
+    // Keeps the invalid results whose name can be fixed
+    class FInvalidAssetsSink final : public INamingConventionValidationReportSink
+    {
+    public:
+        void AddResult(const FAssetData& AssetData, const ENamingConventionValidationResult Result, const FNamingConventionValidationMessage& Message) override
+        {
+            const bool bCanBeFixed = Message.Rule == ENamingConventionValidationRule::WrongPrefix
+                || Message.Rule == ENamingConventionValidationRule::WrongSuffix
+                || Message.Rule == ENamingConventionValidationRule::BlueprintPrefix;
+
+            if (Result == ENamingConventionValidationResult::Invalid && bCanBeFixed)
+            {
+                InvalidAssets.Emplace(AssetData, Message);
+            }
+        }
+
+        TArray<TPair<FAssetData, FNamingConventionValidationMessage>> InvalidAssets;
+    };
+
+    // A prefix is a short upper case word followed by an underscore, such as SM_ or T2D_
+    FStringView GetWrongPrefix(const FStringView AssetName)
+    {
+        static constexpr int32 MaxPrefixLength = 5;
+
+        int32 UnderscoreIndex = INDEX_NONE;
+        if (!AssetName.FindChar(TEXT('_'), UnderscoreIndex) || UnderscoreIndex == 0 || UnderscoreIndex > MaxPrefixLength)
+        {
+            return FStringView();
+        }
+
+        for (int32 CharIndex = 0; CharIndex < UnderscoreIndex; ++CharIndex)
+        {
+            if (!FChar::IsUpper(AssetName[CharIndex]) && !FChar::IsDigit(AssetName[CharIndex]))
+            {
+                return FStringView();
+            }
+        }
+
+        return AssetName.Left(UnderscoreIndex + 1);
+    }
+
+    FString FixPrefix(const FString& AssetName, const FString& Prefix)
+    {
+        return Prefix + FStringView(AssetName).RightChop(GetWrongPrefix(AssetName).Len());
+    }
+}
+
+FString FNamingConventionAssetNameFixer::GetFixedAssetName(const FAssetData& AssetData, const FNamingConventionValidationMessage& Message)
+{
+    static const FTopLevelAssetPath BlueprintGeneratedClassName("/Script/Engine.BlueprintGeneratedClass");
+
+    // The generated class is renamed with its blueprint
+    if (AssetData.AssetClassPath == BlueprintGeneratedClassName)
+    {
+        return FString();
+    }
+
+    const UNamingConventionValidationSettings* Settings = GetDefault<UNamingConventionValidationSettings>();
+    const FString AssetName = AssetData.AssetName.ToString();
+
+    if (Message.Rule == ENamingConventionValidationRule::BlueprintPrefix)
+    {
+        return NamingConventionAssetNameFixer::FixPrefix(AssetName, Settings->BlueprintsPrefix);
+    }
+
+    if ((Message.Rule != ENamingConventionValidationRule::WrongPrefix && Message.Rule != ENamingConventionValidationRule::WrongSuffix)
+        || !Settings->ClassDescriptions.IsValidIndex(Message.RuleArgument))
+    {
+        return FString();
+    }
+
+    // Both the prefix and the suffix are fixed, as the message only tells about the last broken one
+    const FNamingConventionValidationClassDescriptionMatchers& Matchers = Settings->GetClassDescriptionMatchers(Message.RuleArgument);
+    FString FixedAssetName = AssetName;
+
+    if (!Matchers.Prefix.IsEmpty() && Matchers.Prefix.FindMatch(FixedAssetName) == INDEX_NONE)
+    {
+        FixedAssetName = NamingConventionAssetNameFixer::FixPrefix(FixedAssetName, Matchers.Prefix.GetAlternatives()[0]);
+    }
+
+    if (!Matchers.Suffix.IsEmpty() && Matchers.Suffix.FindMatch(FixedAssetName) == INDEX_NONE)
+    {
+        FixedAssetName += Matchers.Suffix.GetAlternatives()[0];
+    }
+
+    // Patterns cannot be fixed, the new name is only used when it follows them
+    if (!Matchers.Pattern.Matches(FixedAssetName))
+    {
+        return FString();
+    }
+
+    return FixedAssetName;
+}
+
+int32 FNamingConventionAssetNameFixer::FixAssetNames(const TArray<FAssetData>& AssetDataList, const FNamingConventionValidationOptions& ValidationOptions, const FNamingConventionAssetNameFixOptions& FixOptions)
+{
+    const UEditorNamingValidatorSubsystem* EditorValidatorSubsystem = GEditor != nullptr ? GEditor->GetEditorSubsystem<UEditorNamingValidatorSubsystem>() : nullptr;
+    if (EditorValidatorSubsystem == nullptr)
+    {
+        UE_LOG(LogNamingConventionValidation, Warning, TEXT("Fixing asset names needs the editor subsystems"));
+        return INDEX_NONE;
+    }
+
+    NamingConventionAssetNameFixer::FInvalidAssetsSink InvalidAssetsSink;
+
+    FNamingConventionValidationOptions Options = ValidationOptions;
+    Options.ReportSinks.Add(&InvalidAssetsSink);
+    EditorValidatorSubsystem->ValidateAssets(AssetDataList, Options);
+
+    TArray<FRename> Renames;
+    PlanRenames(InvalidAssetsSink.InvalidAssets, Renames);
+
+    UE_LOG(LogNamingConventionValidation, Display, TEXT("%d of the %d invalid assets can be renamed"), Renames.Num(), InvalidAssetsSink.InvalidAssets.Num());
+
+    if (!FixOptions.PlanFilename.IsEmpty() && !WritePlan(Renames, FixOptions.PlanFilename))
+    {
+        return INDEX_NONE;
+    }
+
+    if (FixOptions.bDryRun || Renames.IsEmpty())
+    {
+        return Renames.Num();
+    }
+
+    return RenameAssets(Renames, FixOptions.bSavePackages) ? Renames.Num() : INDEX_NONE;
+}
+
+void FNamingConventionAssetNameFixer::PlanRenames(const TArray<TPair<FAssetData, FNamingConventionValidationMessage>>& InvalidAssets, TArray<FRename>& OutRenames)
+{
+    const IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+    TSet<FName> NewPackageNames;
+    NewPackageNames.Reserve(InvalidAssets.Num());
+    OutRenames.Reserve(InvalidAssets.Num());
+
+    TArray<FAssetData> ExistingAssets;
+    TStringBuilder<256> NewPackageName;
+
+    for (const TPair<FAssetData, FNamingConventionValidationMessage>& InvalidAsset : InvalidAssets)
+    {
+        FString NewAssetName = GetFixedAssetName(InvalidAsset.Key, InvalidAsset.Value);
+        if (NewAssetName.IsEmpty() || NewAssetName == InvalidAsset.Key.AssetName.ToString())
+        {
+            continue;
+        }
+
+        NewPackageName.Reset();
+        NewPackageName << InvalidAsset.Key.PackagePath << TEXT('/') << NewAssetName;
+        const FName NewPackageFName(NewPackageName.ToView());
+
+        ExistingAssets.Reset();
+        AssetRegistry.GetAssetsByPackageName(NewPackageFName, ExistingAssets, true);
+
+        bool bIsAlreadyPlanned = false;
+        NewPackageNames.Add(NewPackageFName, &bIsAlreadyPlanned);
+
+        if (!ExistingAssets.IsEmpty() || bIsAlreadyPlanned)
+        {
+            UE_LOG(LogNamingConventionValidation, Warning, TEXT("Impossible to rename %s to %s, which already exists"), *InvalidAsset.Key.PackageName.ToString(), *NewPackageName);
+            continue;
+        }
+
+        OutRenames.Add({ InvalidAsset.Key, MoveTemp(NewAssetName), InvalidAsset.Value.Rule });
+    }
+}
+
+bool FNamingConventionAssetNameFixer::WritePlan(const TArray<FRename>& Renames, const FString& PlanFilename)
+{
+    FString Plan = TEXT("OldObjectPath,NewObjectPath,Rule\n");
+
+    for (const FRename& Rename : Renames)
+    {
+        Plan.Appendf(TEXT("%s,%s/%s.%s,%s\n"),
+            *Rename.AssetData.GetObjectPathString(),
+            *Rename.AssetData.PackagePath.ToString(),
+            *Rename.NewAssetName,
+            *Rename.NewAssetName,
+            *StaticEnum<ENamingConventionValidationRule>()->GetNameStringByValue(static_cast<int64>(Rename.Rule)));
+    }
+
+    if (!FFileHelper::SaveStringToFile(Plan, *PlanFilename))
+    {
+        UE_LOG(LogNamingConventionValidation, Error, TEXT("Impossible to write the planned renames to %s"), *PlanFilename);
+        return false;
+    }
+
+    UE_LOG(LogNamingConventionValidation, Display, TEXT("Wrote %d planned renames to %s"), Renames.Num(), *PlanFilename);
+    return true;
+}
+
+bool FNamingConventionAssetNameFixer::RenameAssets(const TArray<FRename>& Renames, const bool bSavePackages)
+{
+    IAssetTools& AssetTools = FAssetToolsModule::GetModule().Get();
+
+    TArray<FAssetRenameData> RenameData;
+    RenameData.Reserve(Renames.Num());
+
+    // The packages the assets are renamed from, which receive the redirectors
+    TArray<UPackage*> OldPackages;
+    OldPackages.Reserve(Renames.Num());
+
+    bool bSuccess = true;
+    {
+        FScopedSlowTask SlowTask(Renames.Num(), LOCTEXT("NamingConventionLoadingAssetsTask", "Loading the assets to rename..."));
+        SlowTask.MakeDialogDelayed(0.1f);
+
+        for (const FRename& Rename : Renames)
+        {
+            SlowTask.EnterProgressFrame(1.0f, FText::FromName(Rename.AssetData.PackageName));
+
+            UObject* Asset = Rename.AssetData.GetAsset();
+            if (Asset == nullptr)
+            {
+                UE_LOG(LogNamingConventionValidation, Error, TEXT("Impossible to load %s to rename it"), *Rename.AssetData.GetObjectPathString());
+                bSuccess = false;
+                continue;
+            }
+
+            RenameData.Emplace(Asset, Rename.AssetData.PackagePath.ToString(), Rename.NewAssetName);
+            OldPackages.Add(Asset->GetPackage());
+        }
+    }
+
+    bSuccess &= AssetTools.RenameAssets(RenameData);
+
+    // The redirectors left in the old packages are fixed up together, instead of once per asset
+    TArray<UObjectRedirector*> Redirectors;
+    for (int32 RenameIndex = 0; RenameIndex < RenameData.Num(); ++RenameIndex)
+    {
+        const UObject* Asset = RenameData[RenameIndex].Asset.Get();
+        UObjectRedirector* Redirector = FindObjectFast<UObjectRedirector>(OldPackages[RenameIndex], RenameData[RenameIndex].OldObjectPath.GetAssetFName());
+
+        if (Redirector != nullptr && Asset != nullptr && Redirector->DestinationObject == Asset)
+        {
+            Redirectors.Add(Redirector);
+        }
+    }
+
+    if (!Redirectors.IsEmpty())
+    {
+        AssetTools.FixupReferencers(Redirectors, !bSavePackages);
+    }
+
+    if (bSavePackages)
+    {
+        bSuccess &= UEditorLoadingAndSavingUtils::SaveDirtyPackages(true, true);
+    }
+
+    UE_CLOG(!bSuccess, LogNamingConventionValidation, Error, TEXT("Some of the %d assets could not be renamed"), Renames.Num());
+    return bSuccess;
+}
+
+#undef LOCTEXT_NAMESPACE
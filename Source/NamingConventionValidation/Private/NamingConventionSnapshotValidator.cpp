@@ -0,0 +1,328 @@
+#include "NamingConventionSnapshotValidator.h"
+
+#include "EditorNamingValidatorSubsystem.h"
+#include "NamingConventionValidationLog.h"
+
+#include "AssetRegistry/AssetData.h"
+#include "Engine/Blueprint.h"
+#include "Misc/PackageName.h"
+
+namespace NamingConventionSnapshotValidator
+{
+    bool GetClassPathTag(const FAssetData& AssetData, const FName Tag, FTopLevelAssetPath& OutClassPath)
+    {
+        FString ExportTextPath;
+        if (!AssetData.GetTagValue(Tag, ExportTextPath))
+        {
+            return false;
+        }
+
+        OutClassPath = FTopLevelAssetPath(FPackageName::ExportTextPathToObjectPath(ExportTextPath));
+        return OutClassPath.IsValid();
+    }
+
+    // Orders by name index rather than alphabetically, which is enough for the merge as both snapshots are loaded in the same process
+    int32 CompareAssets(const FAssetData& Lhs, const FAssetData& Rhs)
+    {
+        if (const int32 PackageNameOrder = Lhs.PackageName.CompareIndexes(Rhs.PackageName))
+        {
+            return PackageNameOrder;
+        }
+
+        if (const int32 AssetNameOrder = Lhs.AssetName.CompareIndexes(Rhs.AssetName))
+        {
+            return AssetNameOrder;
+        }
+
+        if (const int32 ClassPackageNameOrder = Lhs.AssetClassPath.GetPackageName().CompareIndexes(Rhs.AssetClassPath.GetPackageName()))
+        {
+            return ClassPackageNameOrder;
+        }
+
+        return Lhs.AssetClassPath.GetAssetName().CompareIndexes(Rhs.AssetClassPath.GetAssetName());
+    }
+}
+
+FNamingConventionSnapshotValidator::FNamingConventionSnapshotValidator()
+{
+    // Without the editor subsystem, nothing has built the indices of the settings yet
+    GetMutableDefault<UNamingConventionValidationSettings>()->PostProcessSettings();
+}
+
+bool FNamingConventionSnapshotValidator::LoadSnapshot(const FString& Filename)
+{
+    FAssetRegistryLoadOptions LoadOptions;
+    LoadOptions.bLoadDependencies = false;
+    LoadOptions.bLoadPackageData = false;
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    if (!FAssetRegistryState::LoadFromDisk(*Filename, LoadOptions, State))
+    {
+        UE_LOG(LogNamingConventionValidation, Error, TEXT("Impossible to load the asset registry snapshot %s"), *Filename);
+        return false;
+    }
+
+    BuildClassHierarchy();
+
+    UE_LOG(LogNamingConventionValidation, Display, TEXT("Loaded %d assets and %d blueprint classes from %s in %.2f s"), State.GetNumAssets(), ParentClassPaths.Num(), *Filename, FPlatformTime::Seconds() - StartTime);
+    return true;
+}
+
+const FAssetRegistryState& FNamingConventionSnapshotValidator::GetState() const
+{
+    return State;
+}
+
+ENamingConventionValidationResult FNamingConventionSnapshotValidator::ValidateAsset(FNamingConventionValidationMessage& OutMessage, const FAssetData& AssetData) const
+{
+    OutMessage = FNamingConventionValidationMessage();
+
+    if (GetDefault<UNamingConventionValidationSettings>()->IsPathExcludedFromValidation(AssetData.PackageName))
+    {
+        OutMessage = FNamingConventionValidationMessage(ENamingConventionValidationRule::ExcludedDirectory);
+        return ENamingConventionValidationResult::Excluded;
+    }
+
+    const FTopLevelAssetPath AssetClassPath = UEditorNamingValidatorSubsystem::GetAssetClassPath(AssetData);
+    const FNamingConventionValidationClassVerdict* ClassVerdict = AssetClassPath.IsValid() ? &GetClassVerdict(AssetClassPath) : nullptr;
+
+    return UEditorNamingValidatorSubsystem::DoesAssetMatchRules(OutMessage, AssetData, ClassVerdict);
+}
+
+void FNamingConventionSnapshotValidator::GetAssets(const TArray<FString>& PackagePaths, TArray<const FAssetData*>& OutAssets) const
+{
+    // With a trailing slash, so that only whole folder names match
+    TArray<FString> FolderPaths;
+    for (const FString& PackagePath : PackagePaths)
+    {
+        FolderPaths.Add(PackagePath.EndsWith(TEXT("/")) ? PackagePath : PackagePath + TEXT("/"));
+    }
+
+    OutAssets.Reserve(OutAssets.Num() + State.GetNumAssets());
+
+    State.EnumerateAllAssets([&FolderPaths, &OutAssets](const FAssetData& AssetData) {
+        const FNameBuilder PackageName(AssetData.PackageName);
+
+        const bool bIsInPackagePaths = FolderPaths.ContainsByPredicate([&PackageName](const FString& FolderPath) {
+            return PackageName.ToView().StartsWith(FolderPath);
+        });
+
+        if (bIsInPackagePaths)
+        {
+            OutAssets.Add(&AssetData);
+        }
+
+        return true;
+    });
+}
+
+FNamingConventionValidationSummary FNamingConventionSnapshotValidator::ValidateAssets(const TConstArrayView<const FAssetData*> Assets, const TConstArrayView<INamingConventionValidationReportSink*> ReportSinks) const
+{
+    FNamingConventionValidationSummary Summary;
+    Summary.NumFilesToValidate = Assets.Num();
+
+    for (INamingConventionValidationReportSink* ReportSink : ReportSinks)
+    {
+        ReportSink->BeginReport();
+    }
+
+    FNamingConventionValidationMessage Message;
+
+    for (const FAssetData* AssetData : Assets)
+    {
+        const ENamingConventionValidationResult Result = ValidateAsset(Message, *AssetData);
+        Summary.AddResult(Result);
+
+        for (INamingConventionValidationReportSink* ReportSink : ReportSinks)
+        {
+            ReportSink->AddResult(*AssetData, Result, Message);
+        }
+    }
+
+    for (INamingConventionValidationReportSink* ReportSink : ReportSinks)
+    {
+        ReportSink->EndReport(Summary);
+    }
+
+    return Summary;
+}
+
+void FNamingConventionSnapshotValidator::DiffAssets(TArray<const FAssetData*>& OldAssets, TArray<const FAssetData*>& NewAssets, TArray<const FAssetData*>& OutRemovedAssets, TArray<const FAssetData*>& OutAddedAssets)
+{
+    const auto AssetLess = [](const FAssetData& Lhs, const FAssetData& Rhs) {
+        return NamingConventionSnapshotValidator::CompareAssets(Lhs, Rhs) < 0;
+    };
+
+    OldAssets.Sort(AssetLess);
+    NewAssets.Sort(AssetLess);
+
+    int32 OldIndex = 0;
+    int32 NewIndex = 0;
+
+    while (OldIndex < OldAssets.Num() && NewIndex < NewAssets.Num())
+    {
+        const int32 Order = NamingConventionSnapshotValidator::CompareAssets(*OldAssets[OldIndex], *NewAssets[NewIndex]);
+
+        if (Order < 0)
+        {
+            OutRemovedAssets.Add(OldAssets[OldIndex++]);
+        }
+        else if (Order > 0)
+        {
+            OutAddedAssets.Add(NewAssets[NewIndex++]);
+        }
+        else
+        {
+            ++OldIndex;
+            ++NewIndex;
+        }
+    }
+
+    OutRemovedAssets.Append(OldAssets.GetData() + OldIndex, OldAssets.Num() - OldIndex);
+    OutAddedAssets.Append(NewAssets.GetData() + NewIndex, NewAssets.Num() - NewIndex);
+}
+
+void FNamingConventionSnapshotValidator::PairRenamedAssets(TArray<const FAssetData*>& RemovedAssets, TArray<const FAssetData*>& AddedAssets, TArray<TPair<const FAssetData*, const FAssetData*>>& OutRenamedAssets)
+{
+    TBitArray<> IsRemovedAssetPaired(false, RemovedAssets.Num());
+    TBitArray<> IsAddedAssetPaired(false, AddedAssets.Num());
+
+    const auto PairAssets = [&](const auto& GetKey) {
+        TMap<decltype(GetKey(*RemovedAssets[0])), int32> RemovedAssetIndices;
+        for (int32 RemovedIndex = 0; RemovedIndex < RemovedAssets.Num(); ++RemovedIndex)
+        {
+            if (!IsRemovedAssetPaired[RemovedIndex])
+            {
+                RemovedAssetIndices.FindOrAdd(GetKey(*RemovedAssets[RemovedIndex]), RemovedIndex);
+            }
+        }
+
+        for (int32 AddedIndex = 0; AddedIndex < AddedAssets.Num(); ++AddedIndex)
+        {
+            int32 RemovedIndex = INDEX_NONE;
+            if (!IsAddedAssetPaired[AddedIndex] && RemovedAssetIndices.RemoveAndCopyValue(GetKey(*AddedAssets[AddedIndex]), RemovedIndex))
+            {
+                IsRemovedAssetPaired[RemovedIndex] = true;
+                IsAddedAssetPaired[AddedIndex] = true;
+                OutRenamedAssets.Emplace(RemovedAssets[RemovedIndex], AddedAssets[AddedIndex]);
+            }
+        }
+    };
+
+    if (RemovedAssets.IsEmpty() || AddedAssets.IsEmpty())
+    {
+        return;
+    }
+
+    PairAssets([](const FAssetData& AssetData) {
+        return AssetData.PackageName;
+    });
+
+    PairAssets([](const FAssetData& AssetData) {
+        return TPair<FName, FTopLevelAssetPath>(AssetData.AssetName, AssetData.AssetClassPath);
+    });
+
+    const auto RemovePairedAssets = [](TArray<const FAssetData*>& Assets, const TBitArray<>& IsAssetPaired) {
+        int32 NumKeptAssets = 0;
+        for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); ++AssetIndex)
+        {
+            if (!IsAssetPaired[AssetIndex])
+            {
+                Assets[NumKeptAssets++] = Assets[AssetIndex];
+            }
+        }
+        Assets.SetNum(NumKeptAssets);
+    };
+
+    RemovePairedAssets(RemovedAssets, IsRemovedAssetPaired);
+    RemovePairedAssets(AddedAssets, IsAddedAssetPaired);
+}
+
+void FNamingConventionSnapshotValidator::BuildClassHierarchy()
+{
+    static const FTopLevelAssetPath BlueprintGeneratedClassName("/Script/Engine.BlueprintGeneratedClass");
+
+    ParentClassPaths.Reset();
+    NativeParentClassPaths.Reset();
+    ClassVerdicts.Reset();
+
+    State.EnumerateAllAssets([this](const FAssetData& AssetData) {
+        FTopLevelAssetPath ClassPath;
+        if (!NamingConventionSnapshotValidator::GetClassPathTag(AssetData, FBlueprintTags::GeneratedClassPath, ClassPath))
+        {
+            // Cooked registries may only have the generated class
+            if (AssetData.AssetClassPath != BlueprintGeneratedClassName)
+            {
+                return true;
+            }
+
+            ClassPath = FTopLevelAssetPath(AssetData.PackageName, AssetData.AssetName);
+        }
+
+        FTopLevelAssetPath ParentClassPath;
+        if (NamingConventionSnapshotValidator::GetClassPathTag(AssetData, FBlueprintTags::ParentClassPath, ParentClassPath))
+        {
+            ParentClassPaths.Add(ClassPath, ParentClassPath);
+        }
+
+        FTopLevelAssetPath NativeParentClassPath;
+        if (NamingConventionSnapshotValidator::GetClassPathTag(AssetData, FBlueprintTags::NativeParentClassPath, NativeParentClassPath))
+        {
+            NativeParentClassPaths.Add(ClassPath, NativeParentClassPath);
+        }
+
+        return true;
+    });
+}
+
+void FNamingConventionSnapshotValidator::GetClassHierarchy(const FTopLevelAssetPath& ClassPath, TArray<FTopLevelAssetPath, TInlineAllocator<16>>& OutClassHierarchy) const
+{
+    OutClassHierarchy.Reset();
+
+    const FTopLevelAssetPath* NativeParentClassPath = NativeParentClassPaths.Find(ClassPath);
+    FTopLevelAssetPath CurrentClassPath = ClassPath;
+
+    // The number of classes is bounded, in case the tags of the snapshot describe a cycle
+    while (CurrentClassPath.IsValid() && OutClassHierarchy.Num() < 256)
+    {
+        OutClassHierarchy.Add(CurrentClassPath);
+
+        if (const FTopLevelAssetPath* ParentClassPath = ParentClassPaths.Find(CurrentClassPath))
+        {
+            CurrentClassPath = *ParentClassPath;
+            continue;
+        }
+
+        if (const UClass* Class = FindObject<UClass>(CurrentClassPath))
+        {
+            for (const UClass* SuperClass = Class->GetSuperClass(); SuperClass != nullptr; SuperClass = SuperClass->GetSuperClass())
+            {
+                OutClassHierarchy.Add(SuperClass->GetClassPathName());
+            }
+            return;
+        }
+
+        // The parent is missing from the snapshot, or is a native class of a module which is not loaded
+        if (NativeParentClassPath != nullptr && !OutClassHierarchy.Contains(*NativeParentClassPath))
+        {
+            CurrentClassPath = *NativeParentClassPath;
+            continue;
+        }
+
+        return;
+    }
+}
+
+const FNamingConventionValidationClassVerdict& FNamingConventionSnapshotValidator::GetClassVerdict(const FTopLevelAssetPath& ClassPath) const
+{
+    if (const FNamingConventionValidationClassVerdict* ClassVerdict = ClassVerdicts.Find(ClassPath))
+    {
+        return *ClassVerdict;
+    }
+
+    TArray<FTopLevelAssetPath, TInlineAllocator<16>> ClassHierarchy;
+    GetClassHierarchy(ClassPath, ClassHierarchy);
+
+    return ClassVerdicts.Add(ClassPath, GetDefault<UNamingConventionValidationSettings>()->GetClassVerdictFromHierarchy(ClassHierarchy));
+}
@@ -0,0 +1,542 @@
+#include "NamingConventionValidationBenchmarkCommandlet.h"
+
+#include "EditorNamingValidatorSubsystem.h"
+#include "NamingConventionValidationLog.h"
+#include "NamingConventionValidationSettings.h"
+
+#include "AssetRegistry/AssetData.h"
+#include "Editor.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/IPluginManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include <atomic>
+
+namespace NamingConventionValidationBenchmark
+{
+    using FResult = FNamingConventionValidationBenchmarkResult;
+
+    // Forwards everything to the allocator it wraps and counts the allocations. Only installed during an untimed run of a benchmark
+    class FCountingMalloc final : public FMalloc
+    {
+    public:
+        void* Malloc(const SIZE_T Count, const uint32 Alignment = DEFAULT_ALIGNMENT) override
+        {
+            CountAllocation(Count);
+            return InnerMalloc->Malloc(Count, Alignment);
+        }
+
+        void* TryMalloc(const SIZE_T Count, const uint32 Alignment = DEFAULT_ALIGNMENT) override
+        {
+            CountAllocation(Count);
+            return InnerMalloc->TryMalloc(Count, Alignment);
+        }
+
+        void* Realloc(void* Original, const SIZE_T Count, const uint32 Alignment = DEFAULT_ALIGNMENT) override
+        {
+            CountAllocation(Count);
+            return InnerMalloc->Realloc(Original, Count, Alignment);
+        }
+
+        void* TryRealloc(void* Original, const SIZE_T Count, const uint32 Alignment = DEFAULT_ALIGNMENT) override
+        {
+            CountAllocation(Count);
+            return InnerMalloc->TryRealloc(Original, Count, Alignment);
+        }
+
+        void Free(void* Original) override
+        {
+            InnerMalloc->Free(Original);
+        }
+
+        SIZE_T QuantizeSize(const SIZE_T Count, const uint32 Alignment) override
+        {
+            return InnerMalloc->QuantizeSize(Count, Alignment);
+        }
+
+        bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+        {
+            return InnerMalloc->GetAllocationSize(Original, SizeOut);
+        }
+
+        void Trim(const bool bTrimThreadCaches) override
+        {
+            InnerMalloc->Trim(bTrimThreadCaches);
+        }
+
+        void SetupTLSCachesOnCurrentThread() override
+        {
+            InnerMalloc->SetupTLSCachesOnCurrentThread();
+        }
+
+        void ClearAndDisableTLSCachesOnCurrentThread() override
+        {
+            InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread();
+        }
+
+        bool IsInternallyThreadSafe() const override
+        {
+            return InnerMalloc->IsInternallyThreadSafe();
+        }
+
+        bool ValidateHeap() override
+        {
+            return InnerMalloc->ValidateHeap();
+        }
+
+        const TCHAR* GetDescriptiveName() override
+        {
+            return TEXT("NamingConventionValidationBenchmark");
+        }
+
+        // Counts the allocations of all the threads while Body runs, including the workers of ValidateAssets.
+        // The allocator is never destroyed, as other threads may still be inside one of its functions right after it has been uninstalled
+        static void CountAllocations(const TFunctionRef<void()> Body, int64& OutNumAllocations, int64& OutNumAllocatedBytes)
+        {
+            static FCountingMalloc* CountingMalloc = new FCountingMalloc();
+
+            CountingMalloc->InnerMalloc = GMalloc;
+            CountingMalloc->NumAllocations = 0;
+            CountingMalloc->NumAllocatedBytes = 0;
+            GMalloc = CountingMalloc;
+
+            Body();
+
+            GMalloc = CountingMalloc->InnerMalloc;
+            OutNumAllocations = CountingMalloc->NumAllocations;
+            OutNumAllocatedBytes = CountingMalloc->NumAllocatedBytes;
+        }
+
+    private:
+        void CountAllocation(const SIZE_T Count)
+        {
+            if (Count > 0)
+            {
+                NumAllocations.fetch_add(1, std::memory_order_relaxed);
+                NumAllocatedBytes.fetch_add(static_cast<int64>(Count), std::memory_order_relaxed);
+            }
+        }
+
+        FMalloc* InnerMalloc = nullptr;
+        std::atomic<int64> NumAllocations = 0;
+        std::atomic<int64> NumAllocatedBytes = 0;
+    };
+
+    struct FClassSample
+    {
+        FTopLevelAssetPath ClassPath;
+        const UClass* Class = nullptr;
+        FString Prefix;
+        FString Suffix;
+    };
+
+    // Every native class which has a description. Blueprint classes are left out as they would need to be loaded
+    TArray<FClassSample> GetClassSamples(const UNamingConventionValidationSettings* Settings)
+    {
+        TArray<FClassSample> ClassSamples;
+
+        // Names are built with the first alternative of the prefix and suffix lists
+        const auto GetFirstAffix = [](const FString& AffixList) {
+            FString FirstAffix;
+            if (!AffixList.Split(TEXT(";"), &FirstAffix, nullptr))
+            {
+                FirstAffix = AffixList;
+            }
+            return FirstAffix.TrimStartAndEnd();
+        };
+
+        for (const FNamingConventionValidationClassDescription& ClassDescription : Settings->ClassDescriptions)
+        {
+            const UClass* Class = ClassDescription.ClassPath.Get();
+            if (Class != nullptr && Class->HasAnyClassFlags(CLASS_Native))
+            {
+                ClassSamples.Add({ Class->GetClassPathName(), Class, GetFirstAffix(ClassDescription.Prefix), GetFirstAffix(ClassDescription.Suffix) });
+            }
+        }
+
+        return ClassSamples;
+    }
+
+    // Builds a deterministic set of assets: a few classes are much more common than the others, most assets are spread over many /Game folders,
+    // a few are in developer and engine folders, a few have a class without description and about one out of ten breaks its naming convention
+    void BuildAssets(const int32 NumAssets, const TArray<FClassSample>& ClassSamples, TArray<FAssetData>& OutAssets, TArray<const UClass*>& OutAssetClasses)
+    {
+        const FClassSample UnknownClassSample { UNamingConventionValidationBenchmarkCommandlet::StaticClass()->GetClassPathName(), UNamingConventionValidationBenchmarkCommandlet::StaticClass() };
+        const int32 NumFolders = FMath::Max(1, NumAssets / 40);
+
+        FRandomStream Random(NumAssets);
+        TStringBuilder<256> PackagePath;
+        TStringBuilder<128> AssetName;
+        TStringBuilder<384> PackageName;
+
+        OutAssets.Reset(NumAssets);
+        OutAssetClasses.Reset(NumAssets);
+
+        for (int32 AssetIndex = 0; AssetIndex < NumAssets; ++AssetIndex)
+        {
+            const int32 ClassIndex = FMath::Min(FMath::FloorToInt32(FMath::Square(Random.GetFraction()) * ClassSamples.Num()), ClassSamples.Num() - 1);
+            const FClassSample& ClassSample = Random.GetFraction() < 0.03f ? UnknownClassSample : ClassSamples[ClassIndex];
+
+            const float FolderRoll = Random.GetFraction();
+            PackagePath.Reset();
+
+            if (FolderRoll < 0.03f)
+            {
+                PackagePath.Appendf(TEXT("/Game/Developers/User%d"), Random.RandHelper(20));
+            }
+            else if (FolderRoll < 0.05f)
+            {
+                PackagePath.Appendf(TEXT("/Engine/Plugin%d/Content"), Random.RandHelper(10));
+            }
+            else
+            {
+                const int32 FolderIndex = Random.RandHelper(NumFolders);
+                PackagePath.Appendf(TEXT("/Game/Area%d/Feature%d"), FolderIndex % 16, FolderIndex / 16);
+
+                if (FolderIndex % 3 == 0)
+                {
+                    PackagePath.Appendf(TEXT("/Variant%d"), FolderIndex % 7);
+                }
+            }
+
+            const bool bBreaksConvention = Random.GetFraction() < 0.1f;
+            const bool bBreaksPrefix = bBreaksConvention && !ClassSample.Prefix.IsEmpty();
+            const bool bBreaksSuffix = bBreaksConvention && !bBreaksPrefix;
+
+            AssetName.Reset();
+            AssetName << (bBreaksPrefix ? FStringView() : FStringView(ClassSample.Prefix));
+            AssetName.Appendf(TEXT("Asset%d"), AssetIndex);
+            AssetName << (bBreaksSuffix ? FStringView() : FStringView(ClassSample.Suffix));
+
+            PackageName.Reset();
+            PackageName << PackagePath << TEXT('/') << AssetName;
+
+            OutAssets.Emplace(FName(*PackageName), FName(*PackagePath), FName(*AssetName), ClassSample.ClassPath);
+            OutAssetClasses.Add(ClassSample.Class);
+        }
+    }
+
+    // Matchers of the prefix of each class sample, and of a pattern which accepts the names BuildAssets gives the assets which follow the convention
+    void BuildSampleMatchers(const TArray<FClassSample>& ClassSamples, TArray<FNamingConventionAffixMatcher>& OutPrefixMatchers, TArray<FNamingConventionPatternMatcher>& OutPatternMatchers)
+    {
+        const auto EscapeRegex = [](const FString& Literal) {
+            FString Escaped;
+            for (const TCHAR Character : Literal)
+            {
+                if (FCString::Strchr(TEXT("\\^$.|?*+()[]{}"), Character) != nullptr)
+                {
+                    Escaped.AppendChar(TEXT('\\'));
+                }
+                Escaped.AppendChar(Character);
+            }
+            return Escaped;
+        };
+
+        OutPrefixMatchers.SetNum(ClassSamples.Num());
+        OutPatternMatchers.SetNum(ClassSamples.Num());
+
+        for (int32 SampleIndex = 0; SampleIndex < ClassSamples.Num(); ++SampleIndex)
+        {
+            const FClassSample& ClassSample = ClassSamples[SampleIndex];
+            const FString Pattern = EscapeRegex(ClassSample.Prefix) + TEXT("Asset[0-9]+") + EscapeRegex(ClassSample.Suffix);
+
+            OutPrefixMatchers[SampleIndex].Compile(ClassSample.Prefix, FNamingConventionAffixMatcher::EAffixType::Prefix);
+            OutPatternMatchers[SampleIndex].Compile(Pattern, ENamingConventionPatternSyntax::Regex);
+        }
+    }
+
+    // Runs Body once with its allocations counted, then times it until at least MinSeconds have elapsed, so that the small sets are timed accurately.
+    // Body processes NumTimedAssets of the set of NumAssets assets
+    FResult Measure(const TCHAR* Benchmark, const int32 NumAssets, const int32 NumTimedAssets, const double MinSeconds, const TFunctionRef<void()> Body)
+    {
+        int64 NumAllocations = 0;
+        int64 NumAllocatedBytes = 0;
+        FCountingMalloc::CountAllocations(Body, NumAllocations, NumAllocatedBytes);
+
+        int32 NumIterations = 0;
+        double ElapsedTime = 0.0;
+        const double StartTime = FPlatformTime::Seconds();
+
+        do
+        {
+            Body();
+            ++NumIterations;
+            ElapsedTime = FPlatformTime::Seconds() - StartTime;
+        }
+        while (ElapsedTime < MinSeconds);
+
+        const double NumProcessedAssets = static_cast<double>(NumTimedAssets) * NumIterations;
+
+        FResult Result;
+        Result.Benchmark = Benchmark;
+        Result.NumAssets = NumAssets;
+        Result.AssetsPerSecond = NumProcessedAssets / FMath::Max(ElapsedTime, UE_DOUBLE_SMALL_NUMBER);
+        Result.AllocationsPerAsset = static_cast<double>(NumAllocations) / FMath::Max(NumTimedAssets, 1);
+        Result.AllocatedBytesPerAsset = static_cast<double>(NumAllocatedBytes) / FMath::Max(NumTimedAssets, 1);
+        Result.ProcessPeakMemoryMB = static_cast<double>(FPlatformMemory::GetStats().PeakUsedPhysical) / (1024.0 * 1024.0);
+
+        UE_LOG(LogNamingConventionValidation, Display, TEXT("%-36s %9d assets %14.0f assets/s %8.2f allocs/asset %10.1f bytes/asset %10.1f MB process peak"),
+            *Result.Benchmark, Result.NumAssets, Result.AssetsPerSecond, Result.AllocationsPerAsset, Result.AllocatedBytesPerAsset, Result.ProcessPeakMemoryMB);
+        return Result;
+    }
+
+    bool SaveResults(const TArray<FResult>& Results, const FString& Filename)
+    {
+        FString Csv = TEXT("Benchmark,NumAssets,AssetsPerSecond,AllocationsPerAsset,AllocatedBytesPerAsset,ProcessPeakMemoryMB\n");
+
+        for (const FResult& Result : Results)
+        {
+            Csv.Appendf(TEXT("%s,%d,%.1f,%.2f,%.1f,%.1f\n"), *Result.Benchmark, Result.NumAssets, Result.AssetsPerSecond, Result.AllocationsPerAsset, Result.AllocatedBytesPerAsset, Result.ProcessPeakMemoryMB);
+        }
+
+        if (!FFileHelper::SaveStringToFile(Csv, *Filename))
+        {
+            UE_LOG(LogNamingConventionValidation, Warning, TEXT("Impossible to write the benchmark results to %s"), *Filename);
+            return false;
+        }
+
+        return true;
+    }
+}
+
+UNamingConventionValidationBenchmarkCommandlet::UNamingConventionValidationBenchmarkCommandlet()
+{
+    LogToConsole = false;
+}
+
+int32 UNamingConventionValidationBenchmarkCommandlet::Main(const FString& Params)
+{
+    UE_LOG(LogNamingConventionValidation, Log, TEXT("--------------------------------------------------------------------------------------------"));
+    UE_LOG(LogNamingConventionValidation, Log, TEXT("Running NamingConventionValidationBenchmark Commandlet"));
+    TArray<FString> Tokens;
+    TArray<FString> Switches;
+    TMap<FString, FString> ParamsMap;
+    ParseCommandLine(*Params, Tokens, Switches, ParamsMap);
+
+    TArray<int32> Sizes = { 1000, 10000, 100000, 1000000 };
+    if (const FString* SizesParam = ParamsMap.Find(TEXT("Sizes")))
+    {
+        TArray<FString> SizeStrings;
+        SizesParam->ParseIntoArray(SizeStrings, TEXT(","));
+
+        Sizes.Reset();
+        for (const FString& SizeString : SizeStrings)
+        {
+            const int32 Size = FCString::Atoi(*SizeString);
+            if (Size > 0)
+            {
+                Sizes.Add(Size);
+            }
+        }
+    }
+
+    const FString* MinSecondsParam = ParamsMap.Find(TEXT("MinSeconds"));
+    const double MinSeconds = MinSecondsParam != nullptr ? FCString::Atod(**MinSecondsParam) : 0.5;
+
+    const FString* ToleranceParam = ParamsMap.Find(TEXT("Tolerance"));
+    const double Tolerance = ToleranceParam != nullptr ? FCString::Atod(**ToleranceParam) : 0.2;
+
+    TArray<FNamingConventionValidationBenchmarkResult> Results;
+    if (!RunBenchmarks(Sizes, MinSeconds, Results))
+    {
+        return 2;
+    }
+
+    bool bSuccess = true;
+
+    if (const FString* OutputParam = ParamsMap.Find(TEXT("Output")))
+    {
+        bSuccess &= NamingConventionValidationBenchmark::SaveResults(Results, *OutputParam);
+    }
+
+    if (!Switches.Contains(TEXT("NoBaseline")))
+    {
+        const FString* BaselineParam = ParamsMap.Find(TEXT("Baseline"));
+        bSuccess &= CompareWithBaseline(Results, BaselineParam != nullptr ? *BaselineParam : GetDefaultBaselineFilename(), Tolerance);
+    }
+
+    if (!bSuccess)
+    {
+        UE_LOG(LogNamingConventionValidation, Warning, TEXT("The naming convention validation benchmark did not meet its baseline"));
+        return 2;
+    }
+
+    UE_LOG(LogNamingConventionValidation, Log, TEXT("Successfully finished running NamingConventionValidationBenchmark Commandlet"));
+    UE_LOG(LogNamingConventionValidation, Log, TEXT("--------------------------------------------------------------------------------------------"));
+    return 0;
+}
+
+bool UNamingConventionValidationBenchmarkCommandlet::RunBenchmarks(const TConstArrayView<int32> Sizes, const double MinSeconds, TArray<FNamingConventionValidationBenchmarkResult>& OutResults)
+{
+    using namespace NamingConventionValidationBenchmark;
+
+    if (!GEditor)
+    {
+        UE_LOG(LogNamingConventionValidation, Warning, TEXT("The benchmark needs the editor subsystems"));
+        return false;
+    }
+
+    const UEditorNamingValidatorSubsystem* EditorValidatorSubsystem = GEditor->GetEditorSubsystem<UEditorNamingValidatorSubsystem>();
+    check(EditorValidatorSubsystem);
+
+    const UNamingConventionValidationSettings* Settings = GetDefault<UNamingConventionValidationSettings>();
+
+    const TArray<FClassSample> ClassSamples = GetClassSamples(Settings);
+    if (ClassSamples.IsEmpty())
+    {
+        UE_LOG(LogNamingConventionValidation, Warning, TEXT("There is no class description of a native class to build assets from"));
+        return false;
+    }
+
+    TArray<FNamingConventionAffixMatcher> SamplePrefixMatchers;
+    TArray<FNamingConventionPatternMatcher> SamplePatternMatchers;
+    BuildSampleMatchers(ClassSamples, SamplePrefixMatchers, SamplePatternMatchers);
+
+    TMap<const UClass*, int32> SampleIndexByClass;
+    for (int32 SampleIndex = 0; SampleIndex < ClassSamples.Num(); ++SampleIndex)
+    {
+        SampleIndexByClass.Add(ClassSamples[SampleIndex].Class, SampleIndex);
+    }
+
+    TArray<FAssetData> Assets;
+    TArray<const UClass*> AssetClasses;
+    TArray<FString> AssetNames;
+    TArray<int32> AssetSampleIndices;
+
+    // Keeps the timed work from being optimized away
+    int64 NumValidAssets = 0;
+
+    for (const int32 NumAssets : Sizes)
+    {
+        BuildAssets(NumAssets, ClassSamples, Assets, AssetClasses);
+
+        // The matchers are timed on the assets of the sample classes, with names converted beforehand
+        AssetNames.Reset(NumAssets);
+        AssetSampleIndices.Reset(NumAssets);
+        for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); ++AssetIndex)
+        {
+            if (const int32* SampleIndex = SampleIndexByClass.Find(AssetClasses[AssetIndex]))
+            {
+                AssetNames.Add(Assets[AssetIndex].AssetName.ToString());
+                AssetSampleIndices.Add(*SampleIndex);
+            }
+        }
+
+        OutResults.Add(Measure(TEXT("PrefixMatcher"), NumAssets, AssetNames.Num(), MinSeconds, [&]() {
+            for (int32 NameIndex = 0; NameIndex < AssetNames.Num(); ++NameIndex)
+            {
+                NumValidAssets += SamplePrefixMatchers[AssetSampleIndices[NameIndex]].FindMatch(AssetNames[NameIndex]) != INDEX_NONE ? 1 : 0;
+            }
+        }));
+
+        OutResults.Add(Measure(TEXT("PatternMatcher"), NumAssets, AssetNames.Num(), MinSeconds, [&]() {
+            for (int32 NameIndex = 0; NameIndex < AssetNames.Num(); ++NameIndex)
+            {
+                NumValidAssets += SamplePatternMatchers[AssetSampleIndices[NameIndex]].Matches(AssetNames[NameIndex]) ? 1 : 0;
+            }
+        }));
+
+        OutResults.Add(Measure(TEXT("IsPathExcludedFromValidation"), NumAssets, NumAssets, MinSeconds, [&]() {
+            for (const FAssetData& AssetData : Assets)
+            {
+                NumValidAssets += Settings->IsPathExcludedFromValidation(AssetData.PackageName) ? 0 : 1;
+            }
+        }));
+
+        OutResults.Add(Measure(TEXT("DoesAssetMatchesClassDescriptions"), NumAssets, NumAssets, MinSeconds, [&]() {
+            FNamingConventionValidationMessage Message;
+            for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); ++AssetIndex)
+            {
+                const FNamingConventionValidationClassVerdict ClassVerdict = Settings->GetClassVerdict(AssetClasses[AssetIndex]);
+                const ENamingConventionValidationResult Result = EditorValidatorSubsystem->DoesAssetMatchesClassDescriptions(Message, ClassVerdict, Assets[AssetIndex].AssetName.ToString());
+                NumValidAssets += Result == ENamingConventionValidationResult::Valid ? 1 : 0;
+            }
+        }));
+
+        OutResults.Add(Measure(TEXT("IsAssetNamedCorrectly"), NumAssets, NumAssets, MinSeconds, [&]() {
+            FText ErrorMessage;
+            for (const FAssetData& AssetData : Assets)
+            {
+                NumValidAssets += EditorValidatorSubsystem->IsAssetNamedCorrectly(ErrorMessage, AssetData) == ENamingConventionValidationResult::Valid ? 1 : 0;
+            }
+        }));
+
+        OutResults.Add(Measure(TEXT("ValidateAssets"), NumAssets, NumAssets, MinSeconds, [&]() {
+            // The synthetic assets must neither reach the message log of the user nor the violation index of the editor
+            FNamingConventionValidationOptions Options;
+            Options.bShowIfNoFailures = false;
+            Options.bUseMessageLog = false;
+            Options.bUpdateViolationIndex = false;
+            NumValidAssets += EditorValidatorSubsystem->ValidateAssets(Assets, Options);
+        }));
+    }
+
+    UE_LOG(LogNamingConventionValidation, Verbose, TEXT("%lld valid assets"), NumValidAssets);
+    return true;
+}
+
+bool UNamingConventionValidationBenchmarkCommandlet::CompareWithBaseline(const TConstArrayView<FNamingConventionValidationBenchmarkResult> Results, const FString& BaselineFilename, const double Tolerance)
+{
+    TArray<FString> Lines;
+    if (!FFileHelper::LoadFileToStringArray(Lines, *BaselineFilename))
+    {
+        UE_LOG(LogNamingConventionValidation, Warning, TEXT("Impossible to read the benchmark baseline %s"), *BaselineFilename);
+        return false;
+    }
+
+    bool bSuccess = true;
+    int32 NumComparedResults = 0;
+
+    for (const FString& Line : Lines)
+    {
+        TArray<FString> Columns;
+        Line.ParseIntoArray(Columns, TEXT(","));
+
+        // Skips the header, the comments and the empty lines
+        if (Columns.Num() < 4 || !Columns[1].IsNumeric())
+        {
+            continue;
+        }
+
+        const int32 NumAssets = FCString::Atoi(*Columns[1]);
+        const FNamingConventionValidationBenchmarkResult* Result = Results.FindByPredicate([&](const FNamingConventionValidationBenchmarkResult& Candidate) {
+            return Candidate.Benchmark == Columns[0] && Candidate.NumAssets == NumAssets;
+        });
+
+        if (Result == nullptr)
+        {
+            continue;
+        }
+
+        // The peak memory is only reported, as it is the one of the whole process
+        const double BaselineAssetsPerSecond = FCString::Atod(*Columns[2]);
+        const double BaselineAllocationsPerAsset = FCString::Atod(*Columns[3]);
+        ++NumComparedResults;
+
+        if (Result->AssetsPerSecond < BaselineAssetsPerSecond * (1.0 - Tolerance))
+        {
+            UE_LOG(LogNamingConventionValidation, Warning, TEXT("%s with %d assets: %.0f assets/s, the baseline is %.0f assets/s"), *Result->Benchmark, NumAssets, Result->AssetsPerSecond, BaselineAssetsPerSecond);
+            bSuccess = false;
+        }
+
+        // Allows a fraction of an allocation per asset for the allocations of the other threads, which are counted too
+        if (Result->AllocationsPerAsset > BaselineAllocationsPerAsset * (1.0 + Tolerance) + 0.5)
+        {
+            UE_LOG(LogNamingConventionValidation, Warning, TEXT("%s with %d assets: %.2f allocations/asset, the baseline is %.2f allocations/asset"), *Result->Benchmark, NumAssets, Result->AllocationsPerAsset, BaselineAllocationsPerAsset);
+            bSuccess = false;
+        }
+    }
+
+    UE_CLOG(NumComparedResults == 0, LogNamingConventionValidation, Display, TEXT("The benchmark baseline %s has no result to compare with, record it with -Output"), *BaselineFilename);
+    return bSuccess;
+}
+
+FString UNamingConventionValidationBenchmarkCommandlet::GetDefaultBaselineFilename()
+{
+    const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("NamingConventionValidation"));
+    return Plugin.IsValid() ? FPaths::Combine(Plugin->GetBaseDir(), TEXT("Resources"), TEXT("BenchmarkBaseline.csv")) : FString();
+}
@@ -0,0 +1,271 @@
+#include "NamingConventionValidationCache.h"
+
+#include "NamingConventionValidationLog.h"
+
+#include "Algo/BinarySearch.h"
+#include "AssetRegistry/AssetData.h"
+#include "Engine/Blueprint.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/CityHash.h"
+#include "Misc/Paths.h"
+
+namespace NamingConventionValidationCache
+{
+    static constexpr uint32 Magic = 0x4356434E; // "NCVC"
+    static constexpr uint32 Version = 2;
+}
+
+FNamingConventionValidationCache::FNamingConventionValidationCache(const uint64 InFingerprint) :
+    Fingerprint(InFingerprint)
+{
+}
+
+FNamingConventionValidationCache::~FNamingConventionValidationCache()
+{
+    Unmap();
+}
+
+FString FNamingConventionValidationCache::GetDefaultFilename()
+{
+    return FPaths::ProjectSavedDir() / TEXT("NamingConventionValidation") / TEXT("ValidationCache.bin");
+}
+
+bool FNamingConventionValidationCache::Load(const FString& Filename)
+{
+    Unmap();
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (!PlatformFile.FileExists(*Filename))
+    {
+        return false;
+    }
+
+    FOpenMappedResult OpenResult = PlatformFile.OpenMappedEx(*Filename);
+    if (OpenResult.HasError())
+    {
+        UE_LOG(LogNamingConventionValidation, Warning, TEXT("Impossible to map the validation cache %s"), *Filename);
+        return false;
+    }
+
+    MappedFileHandle = OpenResult.StealValue();
+
+    const int64 FileSize = MappedFileHandle->GetFileSize();
+    if (FileSize < static_cast<int64>(sizeof(FHeader)))
+    {
+        Unmap();
+        return false;
+    }
+
+    MappedFileRegion.Reset(MappedFileHandle->MapRegion(0, FileSize));
+    if (!MappedFileRegion.IsValid())
+    {
+        Unmap();
+        return false;
+    }
+
+    const uint8* Data = MappedFileRegion->GetMappedPtr();
+    const FHeader* Header = reinterpret_cast<const FHeader*>(Data);
+
+    if (Header->Magic != NamingConventionValidationCache::Magic || Header->Version != NamingConventionValidationCache::Version)
+    {
+        UE_LOG(LogNamingConventionValidation, Warning, TEXT("Ignoring the validation cache %s because it has an unknown format"), *Filename);
+        Unmap();
+        return false;
+    }
+
+    if (Header->Fingerprint != Fingerprint)
+    {
+        UE_LOG(LogNamingConventionValidation, Log, TEXT("Ignoring the validation cache %s because the naming rules changed"), *Filename);
+        Unmap();
+        return false;
+    }
+
+    const int64 ExpectedSize = sizeof(FHeader) + static_cast<int64>(Header->NumEntries) * sizeof(FEntry) + Header->MessagesSize;
+    if (FileSize < ExpectedSize)
+    {
+        UE_LOG(LogNamingConventionValidation, Warning, TEXT("Ignoring the validation cache %s because it is truncated"), *Filename);
+        Unmap();
+        return false;
+    }
+
+    NumEntries = static_cast<int32>(Header->NumEntries);
+    Entries = reinterpret_cast<const FEntry*>(Data + sizeof(FHeader));
+    Messages = reinterpret_cast<const UTF8CHAR*>(Entries + NumEntries);
+
+    UE_LOG(LogNamingConventionValidation, Log, TEXT("Loaded %d cached validation results from %s"), NumEntries, *Filename);
+    return true;
+}
+
+bool FNamingConventionValidationCache::Save(const FString& Filename, const bool bDropUnusedResults)
+{
+    TArray<FEntry> NewEntries;
+    NewEntries.Reserve((bDropUnusedResults ? KeptKeys.Num() : NumEntries) + PendingEntries.Num());
+
+    TArray<UTF8CHAR> NewMessages;
+    TMap<uint64, uint32> MessageOffsetsByHash;
+
+    // Identical messages are very common, so they are only stored once
+    auto AddEntry = [&](const uint64 Key, const uint8 Result, const uint8 Rule, const int32 RuleArgument, const UTF8CHAR* Message, const int32 MessageSize) {
+        FEntry& Entry = NewEntries.AddZeroed_GetRef();
+        Entry.Key = Key;
+        Entry.Result = Result;
+        Entry.Rule = Rule;
+        Entry.RuleArgument = RuleArgument;
+        Entry.MessageSize = static_cast<uint16>(FMath::Min(MessageSize, static_cast<int32>(MAX_uint16)));
+
+        const uint64 MessageHash = CityHash64(reinterpret_cast<const char*>(Message), Entry.MessageSize);
+        const uint32* ExistingOffset = MessageOffsetsByHash.Find(MessageHash);
+        if (ExistingOffset != nullptr && FMemory::Memcmp(NewMessages.GetData() + *ExistingOffset, Message, Entry.MessageSize) == 0)
+        {
+            Entry.MessageOffset = *ExistingOffset;
+            return;
+        }
+
+        Entry.MessageOffset = NewMessages.Num();
+        NewMessages.Append(Message, Entry.MessageSize);
+        MessageOffsetsByHash.Add(MessageHash, Entry.MessageOffset);
+    };
+
+    if (bDropUnusedResults)
+    {
+        for (const uint64 Key : KeptKeys)
+        {
+            if (const FEntry* Entry = FindEntry(Key))
+            {
+                AddEntry(Key, Entry->Result, Entry->Rule, Entry->RuleArgument, Messages + Entry->MessageOffset, Entry->MessageSize);
+            }
+        }
+    }
+    else
+    {
+        for (int32 EntryIndex = 0; EntryIndex < NumEntries; ++EntryIndex)
+        {
+            const FEntry& Entry = Entries[EntryIndex];
+            if (!PendingEntries.Contains(Entry.Key))
+            {
+                AddEntry(Entry.Key, Entry.Result, Entry.Rule, Entry.RuleArgument, Messages + Entry.MessageOffset, Entry.MessageSize);
+            }
+        }
+    }
+
+    for (const TPair<uint64, FPendingEntry>& PendingEntry : PendingEntries)
+    {
+        const FNamingConventionValidationMessage& PendingMessage = PendingEntry.Value.Message;
+        const FTCHARToUTF8 Message(*PendingMessage.Text.ToString());
+        AddEntry(PendingEntry.Key, static_cast<uint8>(PendingEntry.Value.Result), static_cast<uint8>(PendingMessage.Rule), PendingMessage.RuleArgument, reinterpret_cast<const UTF8CHAR*>(Message.Get()), Message.Length());
+    }
+
+    NewEntries.Sort([](const FEntry& Lhs, const FEntry& Rhs) {
+        return Lhs.Key < Rhs.Key;
+    });
+
+    // The mapping has to be released before the file can be replaced
+    Unmap();
+
+    const FString TempFilename = Filename + TEXT(".tmp");
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*TempFilename));
+    if (!Writer.IsValid())
+    {
+        UE_LOG(LogNamingConventionValidation, Warning, TEXT("Impossible to write the validation cache %s"), *TempFilename);
+        return false;
+    }
+
+    FHeader Header;
+    FMemory::Memzero(Header);
+    Header.Magic = NamingConventionValidationCache::Magic;
+    Header.Version = NamingConventionValidationCache::Version;
+    Header.Fingerprint = Fingerprint;
+    Header.NumEntries = NewEntries.Num();
+    Header.MessagesSize = NewMessages.Num();
+
+    Writer->Serialize(&Header, sizeof(FHeader));
+    Writer->Serialize(NewEntries.GetData(), NewEntries.Num() * sizeof(FEntry));
+    Writer->Serialize(NewMessages.GetData(), NewMessages.Num());
+
+    const bool bWriteSucceeded = Writer->Close();
+    Writer.Reset();
+
+    if (!bWriteSucceeded || !IFileManager::Get().Move(*Filename, *TempFilename, true, true))
+    {
+        UE_LOG(LogNamingConventionValidation, Warning, TEXT("Impossible to write the validation cache %s"), *Filename);
+        IFileManager::Get().Delete(*TempFilename);
+        return false;
+    }
+
+    KeptKeys.Reset();
+    PendingEntries.Reset();
+
+    UE_LOG(LogNamingConventionValidation, Log, TEXT("Saved %d validation results to %s"), NewEntries.Num(), *Filename);
+    return true;
+}
+
+bool FNamingConventionValidationCache::TryGetResult(const FAssetData& AssetData, ENamingConventionValidationResult& OutResult, FNamingConventionValidationMessage& OutMessage) const
+{
+    const FEntry* Entry = FindEntry(GetKey(AssetData));
+    if (Entry == nullptr)
+    {
+        return false;
+    }
+
+    OutResult = static_cast<ENamingConventionValidationResult>(Entry->Result);
+    OutMessage = FNamingConventionValidationMessage(static_cast<ENamingConventionValidationRule>(Entry->Rule), Entry->RuleArgument);
+    OutMessage.Text = Entry->MessageSize > 0 ? FText::FromString(GetEntryMessage(*Entry)) : FText::GetEmpty();
+    return true;
+}
+
+void FNamingConventionValidationCache::AddResult(const FAssetData& AssetData, const ENamingConventionValidationResult Result, const FNamingConventionValidationMessage& Message)
+{
+    PendingEntries.Add(GetKey(AssetData), { Result, Message });
+}
+
+void FNamingConventionValidationCache::KeepResult(const FAssetData& AssetData)
+{
+    KeptKeys.Add(GetKey(AssetData));
+}
+
+uint64 FNamingConventionValidationCache::GetKey(const FAssetData& AssetData)
+{
+    TStringBuilder<512> KeyBuilder;
+    KeyBuilder << AssetData.PackageName << TEXT('.') << AssetData.AssetName << TEXT('|');
+    AssetData.AssetClassPath.AppendString(KeyBuilder);
+
+    // A reparented blueprint keeps its name and its class path, but may not follow the same rules anymore
+    FString ParentClassName;
+    if (AssetData.GetTagValue(FBlueprintTags::NativeParentClassPath, ParentClassName))
+    {
+        KeyBuilder << TEXT('|') << ParentClassName;
+    }
+    if (AssetData.GetTagValue(FBlueprintTags::ParentClassPath, ParentClassName))
+    {
+        KeyBuilder << TEXT('|') << ParentClassName;
+    }
+
+    return CityHash64(reinterpret_cast<const char*>(KeyBuilder.GetData()), KeyBuilder.Len() * sizeof(TCHAR));
+}
+
+const FNamingConventionValidationCache::FEntry* FNamingConventionValidationCache::FindEntry(const uint64 Key) const
+{
+    const TConstArrayView<FEntry> EntriesView(Entries, NumEntries);
+    const int32 EntryIndex = Algo::LowerBoundBy(EntriesView, Key, [](const FEntry& Entry) {
+        return Entry.Key;
+    });
+
+    return EntriesView.IsValidIndex(EntryIndex) && EntriesView[EntryIndex].Key == Key ? &EntriesView[EntryIndex] : nullptr;
+}
+
+FString FNamingConventionValidationCache::GetEntryMessage(const FEntry& Entry) const
+{
+    const FUTF8ToTCHAR Message(reinterpret_cast<const ANSICHAR*>(Messages + Entry.MessageOffset), Entry.MessageSize);
+    return FString(Message.Length(), Message.Get());
+}
+
+void FNamingConventionValidationCache::Unmap()
+{
+    Entries = nullptr;
+    Messages = nullptr;
+    NumEntries = 0;
+    MappedFileRegion.Reset();
+    MappedFileHandle.Reset();
+}
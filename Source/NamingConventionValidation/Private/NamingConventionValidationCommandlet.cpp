@@ -1,12 +1,125 @@
 #include "NamingConventionValidationCommandlet.h"
 
+#include "NamingConventionValidationCache.h"
 #include "NamingConventionValidationLog.h"
+#include "NamingConventionValidationReport.h"
 #include "EditorNamingValidatorSubsystem.h"
 
 #include "Editor.h"
 #include "AssetRegistry/AssetRegistryHelpers.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+
+namespace NamingConventionValidationCommandlet
+{
+    // Converts the .uasset and .umap files to package names. Relative filenames are relative to BaseDirectory
+    void AppendPackageNamesFromFilenames(const TArray<FString>& Filenames, const FString& BaseDirectory, TArray<FString>& OutPackageFilenames, TArray<FName>& OutPackageNames)
+    {
+        for (const FString& Filename : Filenames)
+        {
+            const FString TrimmedFilename = Filename.TrimStartAndEnd();
+            const FString Extension = FPaths::GetExtension(TrimmedFilename, true);
+
+            if (Extension != FPackageName::GetAssetPackageExtension() && Extension != FPackageName::GetMapPackageExtension())
+            {
+                continue;
+            }
+
+            const FString FullFilename = FPaths::ConvertRelativePathToFull(BaseDirectory, TrimmedFilename);
+
+            FString PackageName;
+            if (!FPackageName::TryConvertFilenameToLongPackageName(FullFilename, PackageName))
+            {
+                UE_LOG(LogNamingConventionValidation, Verbose, TEXT("Skipping %s which is not in a mounted content directory"), *FullFilename);
+                continue;
+            }
+
+            OutPackageFilenames.Add(FullFilename);
+            OutPackageNames.AddUnique(*PackageName);
+        }
+    }
+
+    bool GetPackagesFromFileList(const FString& ListFilename, TArray<FString>& OutPackageFilenames, TArray<FName>& OutPackageNames)
+    {
+        TArray<FString> Filenames;
+        if (!FFileHelper::LoadFileToStringArray(Filenames, *ListFilename))
+        {
+            UE_LOG(LogNamingConventionValidation, Error, TEXT("Impossible to read the file list %s"), *ListFilename);
+            return false;
+        }
+
+        AppendPackageNamesFromFilenames(Filenames, FPaths::ProjectDir(), OutPackageFilenames, OutPackageNames);
+        return true;
+    }
+
+    bool RunGit(const FString& Arguments, const FString& WorkingDirectory, TArray<FString>& OutLines)
+    {
+        int32 ReturnCode = 0;
+        FString StdOut;
+        FString StdErr;
+
+        if (!FPlatformProcess::ExecProcess(TEXT("git"), *Arguments, &ReturnCode, &StdOut, &StdErr, *WorkingDirectory) || ReturnCode != 0)
+        {
+            UE_LOG(LogNamingConventionValidation, Error, TEXT("git %s failed: %s"), *Arguments, *StdErr);
+            return false;
+        }
+
+        TArray<FString> Lines;
+        StdOut.ParseIntoArrayLines(Lines);
+        OutLines.Append(MoveTemp(Lines));
+        return true;
+    }
+
+    // GitRef is passed unquoted on the git command line, so it must be a single argument which git cannot take for an option
+    bool IsValidGitRef(const FString& GitRef)
+    {
+        if (GitRef.IsEmpty() || GitRef[0] == TEXT('-'))
+        {
+            return false;
+        }
+
+        for (const TCHAR Character : GitRef)
+        {
+            if (FChar::IsWhitespace(Character) || FChar::IsControl(Character) || Character == TEXT('"') || Character == TEXT('\'') || Character == TEXT('\\'))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Gets the files which differ from GitRef in the local repository, including the uncommitted and untracked ones
+    bool GetPackagesFromGitDiff(const FString& GitRef, TArray<FString>& OutPackageFilenames, TArray<FName>& OutPackageNames)
+    {
+        if (!IsValidGitRef(GitRef))
+        {
+            UE_LOG(LogNamingConventionValidation, Error, TEXT("%s is not a valid git reference"), *GitRef);
+            return false;
+        }
+
+        const FString ProjectDirectory = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir());
+
+        TArray<FString> RepositoryRoot;
+        if (!RunGit(TEXT("rev-parse --show-toplevel"), ProjectDirectory, RepositoryRoot) || RepositoryRoot.IsEmpty())
+        {
+            return false;
+        }
+
+        TArray<FString> Filenames;
+        if (!RunGit(FString::Printf(TEXT("diff --name-only --diff-filter=d %s --"), *GitRef), ProjectDirectory, Filenames)
+            || !RunGit(TEXT("ls-files --others --exclude-standard --full-name"), ProjectDirectory, Filenames))
+        {
+            return false;
+        }
+
+        AppendPackageNamesFromFilenames(Filenames, RepositoryRoot[0], OutPackageFilenames, OutPackageNames);
+        return true;
+    }
+}
 
 UNamingConventionValidationCommandlet::UNamingConventionValidationCommandlet()
 {
@@ -22,7 +135,96 @@ int32 UNamingConventionValidationCommandlet::Main(const FString& Params)
     TMap<FString, FString> ParamsMap;
     ParseCommandLine(*Params, Tokens, Switches, ParamsMap);
 
-    if (!ValidateData())
+    FNamingConventionValidationOptions Options;
+    Options.bUseMessageLog = !Switches.Contains(TEXT("NoMessageLog"));
+
+    // Never load assets to find out their class, report them as deferred instead
+    Options.bNeverLoadAssets = Switches.Contains(TEXT("NoLoad"));
+
+    TArray<TUniquePtr<FNamingConventionValidationFileSink>> ReportSinks;
+
+    if (const FString* ReportParam = ParamsMap.Find(TEXT("Report")))
+    {
+        if (!FNamingConventionValidationFileSink::CreateReportSinks(*ReportParam, ReportSinks))
+        {
+            return 2;
+        }
+
+        for (const TUniquePtr<FNamingConventionValidationFileSink>& ReportSink : ReportSinks)
+        {
+            Options.ReportSinks.Add(ReportSink.Get());
+        }
+    }
+
+    TUniquePtr<FNamingConventionValidationCache> Cache;
+    FString CacheFilename;
+
+    if (Switches.Contains(TEXT("Incremental")) && GEditor)
+    {
+        if (const FString* CacheFilenameParam = ParamsMap.Find(TEXT("CacheFile")))
+        {
+            CacheFilename = *CacheFilenameParam;
+        }
+        else
+        {
+            CacheFilename = FNamingConventionValidationCache::GetDefaultFilename();
+        }
+
+        const UEditorNamingValidatorSubsystem* EditorValidatorSubsystem = GEditor->GetEditorSubsystem<UEditorNamingValidatorSubsystem>();
+        check(EditorValidatorSubsystem);
+
+        Cache = MakeUnique<FNamingConventionValidationCache>(EditorValidatorSubsystem->GetValidationFingerprint());
+        Cache->Load(CacheFilename);
+        Options.Cache = Cache.Get();
+    }
+
+    TOptional<FNamingConventionAssetNameFixOptions> FixOptions;
+
+    if (Switches.Contains(TEXT("Fix")))
+    {
+        FixOptions.Emplace();
+        FixOptions->bSavePackages = true;
+
+        if (const FString* DryRunParam = ParamsMap.Find(TEXT("DryRun")))
+        {
+            FixOptions->bDryRun = true;
+            FixOptions->PlanFilename = *DryRunParam;
+        }
+    }
+
+    bool bSuccess = true;
+    bool bValidatesAllContent = true;
+
+    const FString* FileListParam = ParamsMap.Find(TEXT("Files"));
+    const FString* GitRefParam = ParamsMap.Find(TEXT("GitDiff"));
+
+    if (FileListParam != nullptr || GitRefParam != nullptr)
+    {
+        TArray<FString> PackageFilenames;
+        TArray<FName> PackageNames;
+        bValidatesAllContent = false;
+
+        bSuccess = FileListParam != nullptr
+            ? NamingConventionValidationCommandlet::GetPackagesFromFileList(*FileListParam, PackageFilenames, PackageNames)
+            : NamingConventionValidationCommandlet::GetPackagesFromGitDiff(*GitRefParam, PackageFilenames, PackageNames);
+
+        if (bSuccess)
+        {
+            bSuccess = ValidatePackages(PackageFilenames, PackageNames, Options, FixOptions.GetPtrOrNull());
+        }
+    }
+    else
+    {
+        bSuccess = ValidateData(Options, FixOptions.GetPtrOrNull());
+    }
+
+    if (Cache.IsValid())
+    {
+        // Results of the assets which were not part of a partial run are still valid
+        Cache->Save(CacheFilename, bValidatesAllContent);
+    }
+
+    if (!bSuccess)
     {
         UE_LOG(LogNamingConventionValidation, Warning, TEXT("Errors occurred while validating naming convention"));
         return 2; // return something other than 1 for error since the engine will return 1 if any other system (possibly unrelated) logged errors during execution.
@@ -33,7 +235,7 @@ int32 UNamingConventionValidationCommandlet::Main(const FString& Params)
     return 0;
 }
 
-bool UNamingConventionValidationCommandlet::ValidateData()
+bool UNamingConventionValidationCommandlet::ValidateData(const FNamingConventionValidationOptions& Options, const FNamingConventionAssetNameFixOptions* FixOptions)
 {
     TArray<FAssetData> AssetDataList;
     FARFilter Filter;
@@ -43,13 +245,47 @@ bool UNamingConventionValidationCommandlet::ValidateData()
     FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName);
     AssetRegistryModule.Get().GetAssets(Filter, AssetDataList);
 
+    return ValidateAssetList(AssetDataList, Options, FixOptions);
+}
+
+bool UNamingConventionValidationCommandlet::ValidatePackages(const TArray<FString>& PackageFilenames, const TArray<FName>& PackageNames, const FNamingConventionValidationOptions& Options, const FNamingConventionAssetNameFixOptions* FixOptions)
+{
+    UE_LOG(LogNamingConventionValidation, Log, TEXT("Validating %d changed packages"), PackageNames.Num());
+
+    if (PackageNames.IsEmpty())
+    {
+        return true;
+    }
+
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName);
+
+    // The editor still runs its usual scan of the content at startup. The changed files are scanned again,
+    // so that the registry also knows about the ones which were modified or added since that scan
+    AssetRegistryModule.Get().ScanFilesSynchronous(PackageFilenames, true);
+
+    FARFilter Filter;
+    Filter.PackageNames = PackageNames;
+
+    TArray<FAssetData> AssetDataList;
+    AssetRegistryModule.Get().GetAssets(Filter, AssetDataList);
+
+    return ValidateAssetList(AssetDataList, Options, FixOptions);
+}
+
+bool UNamingConventionValidationCommandlet::ValidateAssetList(const TArray<FAssetData>& AssetDataList, const FNamingConventionValidationOptions& Options, const FNamingConventionAssetNameFixOptions* FixOptions)
+{
+    if (FixOptions != nullptr)
+    {
+        return FNamingConventionAssetNameFixer::FixAssetNames(AssetDataList, Options, *FixOptions) != INDEX_NONE;
+    }
+
     if (GEditor)
     {
         UEditorNamingValidatorSubsystem* EditorValidatorSubsystem = GEditor->GetEditorSubsystem<UEditorNamingValidatorSubsystem>();
         check(EditorValidatorSubsystem);
 
         // ReSharper disable once CppExpressionWithoutSideEffects
-        EditorValidatorSubsystem->ValidateAssets(AssetDataList);
+        EditorValidatorSubsystem->ValidateAssets(AssetDataList, Options);
     }
 
     return true;
@@ -0,0 +1,52 @@
+#include "NamingConventionValidationFilterExtension.h"
+
+#include "EditorNamingValidatorSubsystem.h"
+
+#include "ContentBrowserItem.h"
+#include "Editor.h"
+#include "FrontendFilterBase.h"
+
+#define LOCTEXT_NAMESPACE "NamingConventionValidationFilterExtension"
+
+class FFrontendFilter_NamingConventionViolations final : public FFrontendFilter
+{
+public:
+    explicit FFrontendFilter_NamingConventionViolations(TSharedPtr<FFrontendFilterCategory> InCategory) :
+        FFrontendFilter(InCategory)
+    {
+    }
+
+    FString GetName() const override
+    {
+        return TEXT("NamingConventionViolations");
+    }
+
+    FText GetDisplayName() const override
+    {
+        return LOCTEXT("NamingConventionViolationsFilter", "Naming Convention Violations");
+    }
+
+    FText GetToolTipText() const override
+    {
+        return LOCTEXT("NamingConventionViolationsFilterTooltip", "Show the assets found invalid by the naming convention validations run in this session.");
+    }
+
+    bool PassesFilter(FAssetFilterType InItem) const override
+    {
+        const UEditorNamingValidatorSubsystem* EditorValidationSubsystem = GEditor != nullptr ? GEditor->GetEditorSubsystem<UEditorNamingValidatorSubsystem>() : nullptr;
+        if (EditorValidationSubsystem == nullptr)
+        {
+            return false;
+        }
+
+        FAssetData AssetData;
+        return InItem.Legacy_TryGetAssetData(AssetData) && EditorValidationSubsystem->GetViolationIndex().Contains(AssetData.GetSoftObjectPath());
+    }
+};
+
+void UNamingConventionValidationFilterExtension::AddFrontEndFilterExtensions(TSharedPtr<FFrontendFilterCategory> DefaultCategory, TArray<TSharedRef<FFrontendFilter>>& InOutFilterList) const
+{
+    InOutFilterList.Add(MakeShared<FFrontendFilter_NamingConventionViolations>(DefaultCategory));
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -1,6 +1,7 @@
 #include "NamingConventionValidationModule.h"
 
 #include "EditorNamingValidatorSubsystem.h"
+#include "NamingConventionAssetNameFixer.h"
 #include "NamingConventionValidationCommandlet.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -13,35 +14,63 @@
 #include "Framework/MultiBox/MultiBoxExtender.h"
 #include "LevelEditor.h"
 #include "Misc/MessageDialog.h"
+#include "Misc/PackageName.h"
 #include "Modules/ModuleManager.h"
 #include "UObject/Object.h"
 #include "UObject/ObjectSaveContext.h"
 
 #define LOCTEXT_NAMESPACE "NamingConventionValidationModule"
 
-void FindAssetDependencies(const FAssetRegistryModule& AssetRegistryModule, const FAssetData& AssetData, TSet<FAssetData>& DependentAssets)
+// Breadth first walk of the package dependencies known by the asset registry, which loads none of the assets
+void FindAssetDependencies(const TArray<FAssetData>& RootAssets, TArray<FAssetData>& OutAssetList)
 {
-    if (AssetData.IsValid())
+    const IAssetRegistry& AssetRegistry = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+    TSet<FName> VisitedPackageNames;
+    TArray<FName> PackageNamesToVisit;
+
+    for (const FAssetData& RootAsset : RootAssets)
     {
-        if (UObject* Object = AssetData.GetAsset())
+        bool bIsAlreadyVisited = false;
+        VisitedPackageNames.Add(RootAsset.PackageName, &bIsAlreadyVisited);
+
+        if (!bIsAlreadyVisited)
         {
-            FAssetIdentifier AssetIdentifier(Object, NAME_None);
+            PackageNamesToVisit.Add(RootAsset.PackageName);
+        }
+    }
+
+    TArray<FName> Dependencies;
 
-            if (!DependentAssets.Contains(AssetData))
+    // The visited packages are appended to the queue, which is never shrunk, so it ends up holding all of them in the order of the walk
+    for (int32 PackageIndex = 0; PackageIndex < PackageNamesToVisit.Num(); ++PackageIndex)
+    {
+        Dependencies.Reset();
+        AssetRegistry.GetDependencies(PackageNamesToVisit[PackageIndex], Dependencies, UE::AssetRegistry::EDependencyCategory::Package);
+
+        for (const FName Dependency : Dependencies)
+        {
+            // The native classes have no asset to validate nor dependencies to follow
+            if (FPackageName::IsScriptPackage(FNameBuilder(Dependency).ToView()))
             {
-                DependentAssets.Add(AssetData);
+                continue;
+            }
 
-                TArray<FAssetDependency> Dependencies;
-                AssetRegistryModule.Get().GetDependencies(AssetIdentifier, Dependencies, UE::AssetRegistry::EDependencyCategory::Package);
+            bool bIsAlreadyVisited = false;
+            VisitedPackageNames.Add(Dependency, &bIsAlreadyVisited);
 
-                for (const FAssetDependency& Dependency : Dependencies)
-                {
-                    FAssetData DependentAsset = AssetRegistryModule.Get().GetAssetByObjectPath(Dependency.AssetId.ToString());
-                    FindAssetDependencies(AssetRegistryModule, DependentAsset, DependentAssets);
-                }
+            if (!bIsAlreadyVisited)
+            {
+                PackageNamesToVisit.Add(Dependency);
             }
         }
     }
+
+    FARFilter Filter;
+    Filter.PackageNames = MoveTemp(PackageNamesToVisit);
+    Filter.bIncludeOnlyOnDiskAssets = true;
+
+    AssetRegistry.GetAssets(Filter, OutAssetList);
 }
 
 void OnPackageSaved(const FString& /*PackageFileName*/, UPackage* Package, FObjectPostSaveContext Context)
@@ -66,7 +95,7 @@ void ValidateAssets(const TArray<FAssetData> SelectedAssets)
     }
 }
 
-void ValidateFolders(const TArray< FString > SelectedFolders)
+void GetFolderAssets(const TArray<FString>& SelectedFolders, TArray<FAssetData>& OutAssetList)
 {
     FAssetRegistryModule& AssetRegistryModule = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
 
@@ -78,12 +107,52 @@ void ValidateFolders(const TArray< FString > SelectedFolders)
         Filter.PackagePaths.Emplace(*Folder);
     }
 
+    AssetRegistryModule.Get().GetAssets(Filter, OutAssetList);
+}
+
+void ValidateAssetsWithDependencies(const TArray<FAssetData> SelectedAssets)
+{
+    if (GEditor)
+    {
+        if (const UEditorNamingValidatorSubsystem* EditorValidationSubsystem = GEditor->GetEditorSubsystem<UEditorNamingValidatorSubsystem>())
+        {
+            TArray<FAssetData> AssetList;
+            FindAssetDependencies(SelectedAssets, AssetList);
+
+            // The dependencies whose class is not known without loading them are reported as deferred
+            FNamingConventionValidationOptions Options;
+            Options.bNeverLoadAssets = true;
+            EditorValidationSubsystem->ValidateAssets(AssetList, Options);
+        }
+    }
+}
+
+void ValidateFolders(const TArray< FString > SelectedFolders)
+{
     TArray<FAssetData> AssetList;
-    AssetRegistryModule.Get().GetAssets(Filter, AssetList);
+    GetFolderAssets(SelectedFolders, AssetList);
 
     ValidateAssets(AssetList);
 }
 
+void FixAssetNames(const TArray<FAssetData> SelectedAssets)
+{
+    const int32 NumRenames = FNamingConventionAssetNameFixer::FixAssetNames(SelectedAssets, FNamingConventionValidationOptions(), FNamingConventionAssetNameFixOptions());
+
+    if (NumRenames == INDEX_NONE)
+    {
+        FMessageDialog::Open(EAppMsgType::Ok, LOCTEXT("NamingConventionFixError", "Some assets could not be renamed. See the log for details."));
+    }
+}
+
+void FixFolderAssetNames(const TArray<FString> SelectedFolders)
+{
+    TArray<FAssetData> AssetList;
+    GetFolderAssets(SelectedFolders, AssetList);
+
+    FixAssetNames(AssetList);
+}
+
 void CreateDataValidationContentBrowserAssetMenu(FMenuBuilder& MenuBuilder, const TArray< FAssetData > SelectedAssets)
 {
     MenuBuilder.AddMenuSeparator();
@@ -92,6 +161,16 @@ void CreateDataValidationContentBrowserAssetMenu(FMenuBuilder& MenuBuilder, cons
         LOCTEXT("NamingConventionValidateAssetsTooltipText", "Run naming convention validation on these assets."),
         FSlateIcon(),
         FUIAction(FExecuteAction::CreateStatic(ValidateAssets, SelectedAssets)));
+    MenuBuilder.AddMenuEntry(
+        LOCTEXT("NamingConventionValidateAssetsWithDependenciesTabTitle", "Validate Naming Convention (with dependencies)"),
+        LOCTEXT("NamingConventionValidateAssetsWithDependenciesTooltipText", "Run naming convention validation on these assets and on all the assets they reference, without loading them."),
+        FSlateIcon(),
+        FUIAction(FExecuteAction::CreateStatic(ValidateAssetsWithDependencies, SelectedAssets)));
+    MenuBuilder.AddMenuEntry(
+        LOCTEXT("NamingConventionFixAssetsTabTitle", "Fix Assets Naming Convention"),
+        LOCTEXT("NamingConventionFixAssetsTooltipText", "Renames these assets when they break a prefix or suffix rule."),
+        FSlateIcon(),
+        FUIAction(FExecuteAction::CreateStatic(FixAssetNames, SelectedAssets)));
 }
 
 TSharedRef<FExtender> OnExtendContentBrowserAssetSelectionMenu(const TArray<FAssetData>& SelectedAssets)
@@ -114,6 +193,11 @@ void CreateDataValidationContentBrowserPathMenu(FMenuBuilder& MenuBuilder, const
         LOCTEXT("NamingConventionValidateAssetsPathTooltipText", "Runs naming convention validation on the assets in the selected folder."),
         FSlateIcon(),
         FUIAction(FExecuteAction::CreateStatic(ValidateFolders, SelectedPaths)));
+    MenuBuilder.AddMenuEntry(
+        LOCTEXT("NamingConventionFixAssetsPathTabTitle", "Fix Assets Naming Convention in Folder"),
+        LOCTEXT("NamingConventionFixAssetsPathTooltipText", "Renames the assets in the selected folder which break a prefix or suffix rule."),
+        FSlateIcon(),
+        FUIAction(FExecuteAction::CreateStatic(FixFolderAssetNames, SelectedPaths)));
 }
 
 TSharedRef<FExtender> OnExtendContentBrowserPathSelectionMenu(const TArray< FString >& SelectedPaths)
@@ -234,4 +318,4 @@ void FNamingConventionValidationModule::ShutdownModule()
     }
 }
 
-#undef LOCTEXT_NAMESPACE
\ No newline at end of file
+#undef LOCTEXT_NAMESPACE
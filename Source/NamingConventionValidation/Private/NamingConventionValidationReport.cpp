@@ -0,0 +1,682 @@
+#include "NamingConventionValidationReport.h"
+
+#include "NamingConventionValidationLog.h"
+#include "NamingConventionValidationSettings.h"
+#include "NamingConventionValidationStats.h"
+
+#include "AssetRegistry/AssetData.h"
+#include "HAL/FileManager.h"
+
+// Shares the namespace of the subsystem, which used to log those messages itself
+#define LOCTEXT_NAMESPACE "NamingConventionValidationManager"
+
+namespace NamingConventionValidationReport
+{
+    static constexpr int32 FlushThreshold = 60 * 1024;
+
+    // Enough for the tests, failures, errors and skipped attributes of a JUnit suite with 10 digit counts
+    static constexpr int32 JUnitCountsLength = 80;
+
+    FString GetResultName(const ENamingConventionValidationResult Result)
+    {
+        return StaticEnum<ENamingConventionValidationResult>()->GetNameStringByValue(static_cast<int64>(Result));
+    }
+
+    FString GetRuleName(const ENamingConventionValidationRule Rule)
+    {
+        return StaticEnum<ENamingConventionValidationRule>()->GetNameStringByValue(static_cast<int64>(Rule));
+    }
+}
+
+void FNamingConventionValidationSummary::AddResult(const ENamingConventionValidationResult Result)
+{
+    switch (Result)
+    {
+    case ENamingConventionValidationResult::Excluded:
+    {
+        ++NumFilesSkipped;
+    }
+    break;
+    case ENamingConventionValidationResult::Valid:
+    {
+        ++NumValidFiles;
+        ++NumFilesChecked;
+    }
+    break;
+    case ENamingConventionValidationResult::Invalid:
+    {
+        ++NumInvalidFiles;
+        ++NumFilesChecked;
+    }
+    break;
+    case ENamingConventionValidationResult::Unknown:
+    {
+        ++NumFilesChecked;
+        ++NumFilesUnableToValidate;
+    }
+    break;
+    case ENamingConventionValidationResult::Deferred:
+    {
+        ++NumFilesDeferred;
+    }
+    break;
+    }
+}
+
+FNamingConventionValidationMergedReportSink::FNamingConventionValidationMergedReportSink(TUniquePtr<INamingConventionValidationReportSink> InReportSink) :
+    ReportSink(MoveTemp(InReportSink))
+{
+}
+
+void FNamingConventionValidationMergedReportSink::AddResult(const FAssetData& AssetData, const ENamingConventionValidationResult Result, const FNamingConventionValidationMessage& Message)
+{
+    ++Summary.NumFilesToValidate;
+    Summary.AddResult(Result);
+    ReportSink->AddResult(AssetData, Result, Message);
+}
+
+void FNamingConventionValidationMergedReportSink::BeginMergedReport()
+{
+    ReportSink->BeginReport();
+}
+
+void FNamingConventionValidationMergedReportSink::EndMergedReport()
+{
+    ReportSink->EndReport(Summary);
+}
+
+const FNamingConventionValidationSummary& FNamingConventionValidationMergedReportSink::GetSummary() const
+{
+    return Summary;
+}
+
+FNamingConventionValidationMessageLogSink::FNamingConventionValidationMessageLogSink(const bool bInShowIfNoFailures) :
+    DataValidationLog("NamingConventionValidation"),
+    bShowIfNoFailures(bInShowIfNoFailures)
+{
+}
+
+void FNamingConventionValidationMessageLogSink::AddResult(const FAssetData& AssetData, const ENamingConventionValidationResult Result, const FNamingConventionValidationMessage& Message)
+{
+    if (Result == ENamingConventionValidationResult::Valid)
+    {
+        return;
+    }
+
+    if (Result == ENamingConventionValidationResult::Unknown && !(bShowIfNoFailures && GetDefault<UNamingConventionValidationSettings>()->bLogWarningWhenNoClassDescriptionForAsset))
+    {
+        return;
+    }
+
+    const FGroupKey GroupKey(Result, Message.Rule, Message.RuleArgument, AssetData.PackagePath);
+
+    TSharedRef<FGroup>* Group = Groups.Find(GroupKey);
+    if (Group == nullptr)
+    {
+        Group = &Groups.Add(GroupKey, MakeShared<FGroup>());
+        (*Group)->Result = Result;
+        (*Group)->PackagePath = AssetData.PackagePath;
+    }
+
+    (*Group)->Records.Add({ AssetData.PackageName, AssetData.AssetClassPath, Message });
+    ++NumRecords;
+}
+
+void FNamingConventionValidationMessageLogSink::EndReport(const FNamingConventionValidationSummary& Summary)
+{
+    NAMING_CONVENTION_VALIDATION_SCOPE(STAT_NamingConventionValidation_MessageLog);
+
+    const UNamingConventionValidationSettings* Settings = GetDefault<UNamingConventionValidationSettings>();
+
+    TArray<TSharedRef<FGroup>> SortedGroups;
+    Groups.GenerateValueArray(SortedGroups);
+    Groups.Reset();
+
+    // Failures first, then by folder. Within a group, the records keep the order of the validated assets
+    SortedGroups.StableSort([](const TSharedRef<FGroup>& Lhs, const TSharedRef<FGroup>& Rhs) {
+        if (Lhs->Result != Rhs->Result)
+        {
+            return Lhs->Result < Rhs->Result;
+        }
+
+        return Lhs->PackagePath.LexicalLess(Rhs->PackagePath);
+    });
+
+    const int32 MaxLines = Settings->MaxMessageLogAssetLines;
+
+    if (Settings->bGroupMessageLogResults && MaxLines > 0 && NumRecords > MaxLines)
+    {
+        for (const TSharedRef<FGroup>& Group : SortedGroups)
+        {
+            AddGroupLine(DataValidationLog, Group);
+        }
+    }
+    else
+    {
+        int32 NumLines = 0;
+
+        for (const TSharedRef<FGroup>& Group : SortedGroups)
+        {
+            NumLines += AddRecordLines(DataValidationLog, *Group, MaxLines > 0 ? MaxLines - NumLines : MAX_int32, FText::GetEmpty());
+        }
+
+        if (NumLines < NumRecords)
+        {
+            DataValidationLog.Info(FText::Format(LOCTEXT("OmittedResults", "{0} more results were not added to the log."), NumRecords - NumLines));
+        }
+    }
+
+    NumRecords = 0;
+
+    const bool bHasFailed = Summary.NumInvalidFiles > 0;
+
+    if (bHasFailed || bShowIfNoFailures)
+    {
+        FFormatNamedArguments Arguments;
+        Arguments.Add(TEXT("Result"), bHasFailed ? LOCTEXT("Failed", "FAILED") : LOCTEXT("Succeeded", "SUCCEEDED"));
+        Arguments.Add(TEXT("NumChecked"), Summary.NumFilesChecked);
+        Arguments.Add(TEXT("NumValid"), Summary.NumValidFiles);
+        Arguments.Add(TEXT("NumInvalid"), Summary.NumInvalidFiles);
+        Arguments.Add(TEXT("NumSkipped"), Summary.NumFilesSkipped);
+        Arguments.Add(TEXT("NumUnableToValidate"), Summary.NumFilesUnableToValidate);
+        Arguments.Add(TEXT("NumDeferred"), Summary.NumFilesDeferred);
+        Arguments.Add(TEXT("NumFromCache"), Summary.NumFilesFromCache);
+        Arguments.Add(TEXT("CacheHitRate"), FText::AsPercent(Summary.NumFilesToValidate > 0 ? static_cast<float>(Summary.NumFilesFromCache) / static_cast<float>(Summary.NumFilesToValidate) : 0.0f));
+
+        TSharedRef<FTokenizedMessage> ValidationLog = bHasFailed ? DataValidationLog.Error() : DataValidationLog.Info();
+        ValidationLog->AddToken(FTextToken::Create(FText::Format(LOCTEXT("SuccessOrFailure", "NamingConvention Validation {Result}."), Arguments)));
+        ValidationLog->AddToken(FTextToken::Create(FText::Format(LOCTEXT("ResultsSummary", "Files Checked: {NumChecked}, Passed: {NumValid}, Failed: {NumInvalid}, Skipped: {NumSkipped}, Unable to validate: {NumUnableToValidate}"), Arguments)));
+
+        if (Summary.NumFilesDeferred > 0)
+        {
+            ValidationLog->AddToken(FTextToken::Create(FText::Format(LOCTEXT("DeferredSummary", "Deferred (would require loading): {NumDeferred}"), Arguments)));
+        }
+
+        if (Summary.bUsedCache)
+        {
+            ValidationLog->AddToken(FTextToken::Create(FText::Format(LOCTEXT("CacheSummary", "Reused from cache: {NumFromCache} ({CacheHitRate})"), Arguments)));
+        }
+
+        for (const FNamingConventionValidatorStats& Stats : Summary.ValidatorStats)
+        {
+            FFormatNamedArguments ValidatorArguments;
+            ValidatorArguments.Add(TEXT("Validator"), FText::FromString(Stats.ValidatorName));
+            ValidatorArguments.Add(TEXT("NumCalls"), Stats.NumCalls);
+            ValidatorArguments.Add(TEXT("NumVerdicts"), Stats.NumVerdicts);
+            ValidatorArguments.Add(TEXT("HitRate"), FText::AsPercent(Stats.NumCalls > 0 ? static_cast<double>(Stats.NumVerdicts) / static_cast<double>(Stats.NumCalls) : 0.0));
+            ValidatorArguments.Add(TEXT("TotalTime"), FText::AsNumber(Stats.TotalSeconds * 1000.0));
+            ValidatorArguments.Add(TEXT("MaxTime"), FText::AsNumber(Stats.MaxSeconds * 1000.0));
+
+            const TSharedRef<FTokenizedMessage> ValidatorLog = Stats.bIsDemoted || Stats.bIsDisabled ? DataValidationLog.Warning() : DataValidationLog.Info();
+            ValidatorLog->AddToken(FTextToken::Create(FText::Format(LOCTEXT("ValidatorSummary", "Validator {Validator}: {NumCalls} calls, {NumVerdicts} verdicts ({HitRate}), {TotalTime} ms total, {MaxTime} ms max."), ValidatorArguments)));
+
+            if (Stats.bIsDisabled)
+            {
+                ValidatorLog->AddToken(FTextToken::Create(LOCTEXT("ValidatorDisabled", "Disabled after exceeding its time budget.")));
+            }
+            else if (Stats.bIsDemoted)
+            {
+                ValidatorLog->AddToken(FTextToken::Create(LOCTEXT("ValidatorDemoted", "Demoted after exceeding its time budget.")));
+            }
+        }
+
+        DataValidationLog.Open(EMessageSeverity::Info, true);
+    }
+}
+
+void FNamingConventionValidationMessageLogSink::AddGroupLine(FMessageLog& MessageLog, const TSharedRef<const FGroup>& Group)
+{
+    FFormatNamedArguments Arguments;
+    Arguments.Add(TEXT("NumAssets"), Group->Records.Num());
+    Arguments.Add(TEXT("PackagePath"), FText::FromName(Group->PackagePath));
+
+    EMessageSeverity::Type Severity = EMessageSeverity::Info;
+    FText Description;
+
+    switch (Group->Result)
+    {
+    case ENamingConventionValidationResult::Invalid:
+        Severity = EMessageSeverity::Error;
+        Description = FText::Format(LOCTEXT("InvalidNamingConventionGroup", "{NumAssets} assets in {PackagePath} do not match naming convention."), Arguments);
+        break;
+    case ENamingConventionValidationResult::Unknown:
+        Severity = EMessageSeverity::Warning;
+        Description = FText::Format(LOCTEXT("UnknownNamingConventionGroup", "{NumAssets} assets in {PackagePath} have no known naming convention."), Arguments);
+        break;
+    case ENamingConventionValidationResult::Deferred:
+        Description = FText::Format(LOCTEXT("DeferredNamingConventionGroup", "{NumAssets} assets in {PackagePath} have not been tested because they would need to be loaded."), Arguments);
+        break;
+    default:
+        Description = FText::Format(LOCTEXT("ExcludedNamingConventionGroup", "{NumAssets} assets in {PackagePath} have not been tested based on the configuration."), Arguments);
+        break;
+    }
+
+    // All the records of a group share their rule, but the editor validators each have their own messages.
+    // The rule is formatted now for the lines of the assets too, as the settings may have changed when the group is expanded
+    const FNamingConventionValidationMessage& Message = Group->Records[0].Message;
+    const FText RecordsText = Message.Rule == ENamingConventionValidationRule::Validator ? FText::GetEmpty() : Message.ToText();
+    const FText RuleText = Message.Rule == ENamingConventionValidationRule::Validator
+        ? LOCTEXT("ValidatorNamingConventionGroup", "Rejected by the editor validators.")
+        : RecordsText;
+
+    MessageLog.Message(Severity)
+        ->AddToken(FTextToken::Create(Description))
+        ->AddToken(FTextToken::Create(RuleText))
+        ->AddToken(FActionToken::Create(
+            LOCTEXT("ShowGroupAssets", "Show assets"),
+            LOCTEXT("ShowGroupAssetsDescription", "Adds a line for each asset of this group to the log"),
+            FOnActionTokenExecuted::CreateLambda([Group, RecordsText]() {
+                NAMING_CONVENTION_VALIDATION_SCOPE(STAT_NamingConventionValidation_MessageLog);
+
+                FMessageLog GroupMessageLog("NamingConventionValidation");
+                const int32 MaxLines = GetDefault<UNamingConventionValidationSettings>()->MaxMessageLogAssetLines;
+                const int32 NumLines = AddRecordLines(GroupMessageLog, *Group, MaxLines > 0 ? MaxLines : MAX_int32, RecordsText);
+
+                if (NumLines < Group->Records.Num())
+                {
+                    GroupMessageLog.Info(FText::Format(LOCTEXT("OmittedGroupResults", "{0} more assets of this group were not added to the log."), Group->Records.Num() - NumLines));
+                }
+            }),
+            /*bInSingleUse=*/true));
+}
+
+int32 FNamingConventionValidationMessageLogSink::AddRecordLines(FMessageLog& MessageLog, const FGroup& Group, const int32 MaxLines, const FText& RuleText)
+{
+    const int32 NumLines = FMath::Min(MaxLines, Group.Records.Num());
+
+    for (int32 RecordIndex = 0; RecordIndex < NumLines; ++RecordIndex)
+    {
+        AddRecordLine(MessageLog, Group.Result, Group.Records[RecordIndex], RuleText);
+    }
+
+    return NumLines;
+}
+
+void FNamingConventionValidationMessageLogSink::AddRecordLine(FMessageLog& MessageLog, const ENamingConventionValidationResult Result, const FRecord& Record, const FText& RuleText)
+{
+    const FText MessageText = RuleText.IsEmpty() ? Record.Message.ToText() : RuleText;
+
+    switch (Result)
+    {
+    case ENamingConventionValidationResult::Excluded:
+    {
+        MessageLog.Info()
+            ->AddToken(FAssetNameToken::Create(Record.PackageName.ToString()))
+            ->AddToken(FTextToken::Create(LOCTEXT("ExcludedNamingConventionResult", "has not been tested based on the configuration.")))
+            ->AddToken(FTextToken::Create(MessageText));
+    }
+    break;
+    case ENamingConventionValidationResult::Invalid:
+    {
+        MessageLog.Error()
+            ->AddToken(FAssetNameToken::Create(Record.PackageName.ToString()))
+            ->AddToken(FTextToken::Create(LOCTEXT("InvalidNamingConventionResult", "does not match naming convention.")))
+            ->AddToken(FTextToken::Create(MessageText));
+    }
+    break;
+    case ENamingConventionValidationResult::Unknown:
+    {
+        FFormatNamedArguments Arguments;
+        Arguments.Add(TEXT("ClassName"), FText::FromString(Record.AssetClassPath.ToString()));
+
+        MessageLog.Warning()
+            ->AddToken(FAssetNameToken::Create(Record.PackageName.ToString()))
+            ->AddToken(FTextToken::Create(LOCTEXT("UnknownNamingConventionResult", "has no known naming convention.")))
+            ->AddToken(FTextToken::Create(FText::Format(LOCTEXT("UnknownClass", " Class = {ClassName}"), Arguments)));
+    }
+    break;
+    case ENamingConventionValidationResult::Deferred:
+    {
+        MessageLog.Info()
+            ->AddToken(FAssetNameToken::Create(Record.PackageName.ToString()))
+            ->AddToken(FTextToken::Create(LOCTEXT("DeferredNamingConventionResult", "has not been tested because it would need to be loaded.")))
+            ->AddToken(FTextToken::Create(MessageText));
+    }
+    break;
+    default:
+        break;
+    }
+}
+
+FNamingConventionValidationFileSink::FNamingConventionValidationFileSink(const FString& InFilename) :
+    Filename(InFilename),
+    Writer(IFileManager::Get().CreateFileWriter(*InFilename))
+{
+    UE_CLOG(!Writer.IsValid(), LogNamingConventionValidation, Error, TEXT("Impossible to create the report file %s"), *Filename);
+}
+
+FNamingConventionValidationFileSink::~FNamingConventionValidationFileSink()
+{
+    Flush();
+
+    if (Writer.IsValid())
+    {
+        Writer->Close();
+    }
+}
+
+bool FNamingConventionValidationFileSink::CreateReportSinks(const FString& ReportParam, TArray<TUniquePtr<FNamingConventionValidationFileSink>>& OutReportSinks)
+{
+    TArray<FString> Reports;
+    ReportParam.ParseIntoArray(Reports, TEXT(","));
+
+    for (const FString& Report : Reports)
+    {
+        FString Format;
+        FString Filename;
+        if (!Report.Split(TEXT(":"), &Format, &Filename) || Filename.IsEmpty())
+        {
+            UE_LOG(LogNamingConventionValidation, Error, TEXT("Invalid report %s, expected <format>:<filename>"), *Report);
+            return false;
+        }
+
+        TUniquePtr<FNamingConventionValidationFileSink> ReportSink;
+        if (Format == TEXT("jsonl"))
+        {
+            ReportSink = MakeUnique<FNamingConventionValidationJsonLinesSink>(Filename);
+        }
+        else if (Format == TEXT("junit"))
+        {
+            ReportSink = MakeUnique<FNamingConventionValidationJUnitSink>(Filename);
+        }
+        else
+        {
+            UE_LOG(LogNamingConventionValidation, Error, TEXT("Unknown report format %s, expected jsonl or junit"), *Format);
+            return false;
+        }
+
+        if (!ReportSink->IsValid())
+        {
+            return false;
+        }
+
+        OutReportSinks.Add(MoveTemp(ReportSink));
+    }
+
+    return true;
+}
+
+bool FNamingConventionValidationFileSink::IsValid() const
+{
+    return Writer.IsValid();
+}
+
+void FNamingConventionValidationFileSink::Write(const FStringView Text)
+{
+    Buffer << Text;
+
+    if (Buffer.Len() >= NamingConventionValidationReport::FlushThreshold)
+    {
+        Flush();
+    }
+}
+
+void FNamingConventionValidationFileSink::Flush()
+{
+    if (Writer.IsValid() && Buffer.Len() > 0)
+    {
+        Writer->Serialize(const_cast<UTF8CHAR*>(Buffer.GetData()), Buffer.Len() * sizeof(UTF8CHAR));
+    }
+
+    Buffer.Reset();
+}
+
+int64 FNamingConventionValidationFileSink::Tell() const
+{
+    return Writer.IsValid() ? Writer->Tell() + Buffer.Len() : 0;
+}
+
+void FNamingConventionValidationFileSink::WriteAt(const int64 Offset, const FStringView Text)
+{
+    Flush();
+
+    if (Writer.IsValid())
+    {
+        const int64 EndOffset = Writer->Tell();
+
+        TUtf8StringBuilder<256> Utf8Text;
+        Utf8Text << Text;
+
+        Writer->Seek(Offset);
+        Writer->Serialize(const_cast<UTF8CHAR*>(Utf8Text.GetData()), Utf8Text.Len() * sizeof(UTF8CHAR));
+        Writer->Seek(EndOffset);
+    }
+}
+
+FNamingConventionValidationJsonLinesSink::FNamingConventionValidationJsonLinesSink(const FString& InFilename) :
+    FNamingConventionValidationFileSink(InFilename)
+{
+}
+
+void FNamingConventionValidationJsonLinesSink::AddResult(const FAssetData& AssetData, const ENamingConventionValidationResult Result, const FNamingConventionValidationMessage& Message)
+{
+    TStringBuilder<512> Line;
+    TStringBuilder<256> ClassPath;
+    AssetData.AssetClassPath.AppendString(ClassPath);
+
+    Line << TEXT("{\"package\":\"");
+    AppendEscaped(Line, FNameBuilder(AssetData.PackageName).ToView());
+    Line << TEXT("\",\"asset\":\"");
+    AppendEscaped(Line, FNameBuilder(AssetData.AssetName).ToView());
+    Line << TEXT("\",\"class\":\"");
+    AppendEscaped(Line, ClassPath.ToView());
+    Line << TEXT("\",\"result\":\"") << NamingConventionValidationReport::GetResultName(Result);
+    Line << TEXT("\",\"rule\":\"") << NamingConventionValidationReport::GetRuleName(Message.Rule);
+    Line << TEXT("\",\"message\":\"");
+    AppendEscaped(Line, Message.ToText().ToString());
+    Line << TEXT("\"}\n");
+
+    Write(Line);
+}
+
+void FNamingConventionValidationJsonLinesSink::EndReport(const FNamingConventionValidationSummary& Summary)
+{
+    TStringBuilder<1024> Line;
+    Line.Appendf(
+        TEXT("{\"summary\":{\"checked\":%d,\"valid\":%d,\"invalid\":%d,\"skipped\":%d,\"unknown\":%d,\"deferred\":%d,\"cached\":%d,\"validators\":["),
+        Summary.NumFilesChecked,
+        Summary.NumValidFiles,
+        Summary.NumInvalidFiles,
+        Summary.NumFilesSkipped,
+        Summary.NumFilesUnableToValidate,
+        Summary.NumFilesDeferred,
+        Summary.NumFilesFromCache);
+
+    for (int32 StatsIndex = 0; StatsIndex < Summary.ValidatorStats.Num(); ++StatsIndex)
+    {
+        const FNamingConventionValidatorStats& Stats = Summary.ValidatorStats[StatsIndex];
+        Line << (StatsIndex > 0 ? TEXT(",{\"name\":\"") : TEXT("{\"name\":\""));
+        AppendEscaped(Line, Stats.ValidatorName);
+        Line.Appendf(
+            TEXT("\",\"calls\":%lld,\"validations\":%lld,\"verdicts\":%lld,\"totalMs\":%.3f,\"maxMs\":%.3f,\"demoted\":%s,\"disabled\":%s}"),
+            Stats.NumCalls,
+            Stats.NumValidations,
+            Stats.NumVerdicts,
+            Stats.TotalSeconds * 1000.0,
+            Stats.MaxSeconds * 1000.0,
+            Stats.bIsDemoted ? TEXT("true") : TEXT("false"),
+            Stats.bIsDisabled ? TEXT("true") : TEXT("false"));
+    }
+
+    Line << TEXT("]}}\n");
+
+    Write(Line);
+    Flush();
+}
+
+void FNamingConventionValidationJsonLinesSink::AppendEscaped(FStringBuilderBase& Output, const FStringView Text) const
+{
+    for (const TCHAR Character : Text)
+    {
+        switch (Character)
+        {
+        case TEXT('"'):
+            Output << TEXT("\\\"");
+            break;
+        case TEXT('\\'):
+            Output << TEXT("\\\\");
+            break;
+        case TEXT('\n'):
+            Output << TEXT("\\n");
+            break;
+        case TEXT('\r'):
+            Output << TEXT("\\r");
+            break;
+        case TEXT('\t'):
+            Output << TEXT("\\t");
+            break;
+        default:
+            if (Character < 0x20)
+            {
+                Output.Appendf(TEXT("\\u%04x"), static_cast<uint32>(Character));
+            }
+            else
+            {
+                Output.AppendChar(Character);
+            }
+            break;
+        }
+    }
+}
+
+FNamingConventionValidationJUnitSink::FNamingConventionValidationJUnitSink(const FString& InFilename) :
+    FNamingConventionValidationFileSink(InFilename)
+{
+}
+
+void FNamingConventionValidationJUnitSink::BeginReport()
+{
+    NumTests = 0;
+    NumFailures = 0;
+    NumSkipped = 0;
+
+    // Blanks are reserved in the opening tags, to be replaced by the counts once they are known
+    const FString CountsPlaceholder = FString::ChrN(NamingConventionValidationReport::JUnitCountsLength, TEXT(' '));
+
+    Write(TEXT("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<testsuites name=\"NamingConventionValidation\""));
+    TestSuitesCountsOffset = Tell();
+    Write(CountsPlaceholder);
+    Write(TEXT(">\n<testsuite name=\"NamingConventionValidation\""));
+    TestSuiteCountsOffset = Tell();
+    Write(CountsPlaceholder);
+    Write(TEXT(">\n"));
+}
+
+void FNamingConventionValidationJUnitSink::AddResult(const FAssetData& AssetData, const ENamingConventionValidationResult Result, const FNamingConventionValidationMessage& Message)
+{
+    TStringBuilder<512> TestCase;
+    TStringBuilder<256> ClassPath;
+    AssetData.AssetClassPath.AppendString(ClassPath);
+
+    TestCase << TEXT("<testcase classname=\"");
+    AppendEscaped(TestCase, ClassPath.ToView());
+    TestCase << TEXT("\" name=\"");
+    AppendEscaped(TestCase, FNameBuilder(AssetData.PackageName).ToView());
+    TestCase << TEXT('.');
+    AppendEscaped(TestCase, FNameBuilder(AssetData.AssetName).ToView());
+    TestCase << TEXT("\"");
+
+    const FString ErrorMessage = Result != ENamingConventionValidationResult::Valid ? Message.ToText().ToString() : FString();
+
+    ++NumTests;
+
+    switch (Result)
+    {
+    case ENamingConventionValidationResult::Invalid:
+        ++NumFailures;
+        TestCase << TEXT("><failure message=\"");
+        AppendEscaped(TestCase, ErrorMessage);
+        TestCase << TEXT("\"/></testcase>\n");
+        break;
+    case ENamingConventionValidationResult::Excluded:
+    case ENamingConventionValidationResult::Deferred:
+    case ENamingConventionValidationResult::Unknown:
+        ++NumSkipped;
+        TestCase << TEXT("><skipped message=\"") << NamingConventionValidationReport::GetResultName(Result);
+        if (!ErrorMessage.IsEmpty())
+        {
+            TestCase << TEXT(": ");
+            AppendEscaped(TestCase, ErrorMessage);
+        }
+        TestCase << TEXT("\"/></testcase>\n");
+        break;
+    default:
+        TestCase << TEXT("/>\n");
+        break;
+    }
+
+    Write(TestCase);
+}
+
+void FNamingConventionValidationJUnitSink::EndReport(const FNamingConventionValidationSummary& Summary)
+{
+    TStringBuilder<1024> SystemOut;
+    SystemOut.Appendf(
+        TEXT("<system-out>Files Checked: %d, Passed: %d, Failed: %d, Skipped: %d, Unable to validate: %d, Deferred: %d\n"),
+        Summary.NumFilesChecked,
+        Summary.NumValidFiles,
+        Summary.NumInvalidFiles,
+        Summary.NumFilesSkipped,
+        Summary.NumFilesUnableToValidate,
+        Summary.NumFilesDeferred);
+
+    for (const FNamingConventionValidatorStats& Stats : Summary.ValidatorStats)
+    {
+        SystemOut << TEXT("Validator ");
+        AppendEscaped(SystemOut, Stats.ValidatorName);
+        SystemOut.Appendf(TEXT(": %lld calls, %lld verdicts, %.1f ms total, %.2f ms max%s\n"),
+            Stats.NumCalls,
+            Stats.NumVerdicts,
+            Stats.TotalSeconds * 1000.0,
+            Stats.MaxSeconds * 1000.0,
+            Stats.bIsDisabled ? TEXT(", disabled") : Stats.bIsDemoted ? TEXT(", demoted") : TEXT(""));
+    }
+
+    SystemOut << TEXT("</system-out>\n</testsuite>\n</testsuites>\n");
+
+    Write(SystemOut);
+
+    TStringBuilder<NamingConventionValidationReport::JUnitCountsLength + 1> Counts;
+    Counts.Appendf(TEXT(" tests=\"%d\" failures=\"%d\" errors=\"0\" skipped=\"%d\""), NumTests, NumFailures, NumSkipped);
+    check(Counts.Len() <= NamingConventionValidationReport::JUnitCountsLength);
+
+    WriteAt(TestSuitesCountsOffset, Counts);
+    WriteAt(TestSuiteCountsOffset, Counts);
+}
+
+void FNamingConventionValidationJUnitSink::AppendEscaped(FStringBuilderBase& Output, const FStringView Text) const
+{
+    for (const TCHAR Character : Text)
+    {
+        switch (Character)
+        {
+        case TEXT('&'):
+            Output << TEXT("&amp;");
+            break;
+        case TEXT('<'):
+            Output << TEXT("&lt;");
+            break;
+        case TEXT('>'):
+            Output << TEXT("&gt;");
+            break;
+        case TEXT('"'):
+            Output << TEXT("&quot;");
+            break;
+        case TEXT('\''):
+            Output << TEXT("&apos;");
+            break;
+        default:
+            if (Character < 0x20 && Character != TEXT('\n') && Character != TEXT('\t'))
+            {
+                Output << TEXT(' ');
+            }
+            else
+            {
+                Output.AppendChar(Character);
+            }
+            break;
+        }
+    }
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -1,86 +1,413 @@
 #include "NamingConventionValidation/Public/NamingConventionValidationSettings.h"
 #include "NamingConventionValidationLog.h"
 
+#include "AssetRegistry/IAssetRegistry.h"
+
 UNamingConventionValidationSettings::UNamingConventionValidationSettings()
 {
     bLogWarningWhenNoClassDescriptionForAsset = false;
     bAllowValidationInDevelopersFolder = false;
     bAllowValidationOnlyInGameFolder = true;
     bDoesValidateOnSave = true;
+    bEnableLiveValidation = false;
+    ValidateOnSaveDebounceSeconds = 0.25f;
+    ValidateOnSaveTimeSliceSeconds = 0.01f;
+    bAllowLoadingAssetsToResolveClass = true;
     BlueprintsPrefix = "BP_";
+    ValidatorTimeBudgetSeconds = 0.0f;
+    ValidatorBudgetExceededAction = ENamingConventionValidatorBudgetAction::Demote;
+    bGroupMessageLogResults = true;
+    MaxMessageLogAssetLines = 500;
 
     ResetValidatorClassDescriptionsToEpicDefaults();
 }
 
-bool UNamingConventionValidationSettings::IsPathExcludedFromValidation(const FString& Path) const
+bool UNamingConventionValidationSettings::IsPathExcludedFromValidation(const FStringView Path) const
 {
-    if (!Path.StartsWith("/Game/") && bAllowValidationOnlyInGameFolder)
+    if (!Path.StartsWith(TEXT("/Game/")) && bAllowValidationOnlyInGameFolder)
     {
-        bool bCanProcessFolder = NonGameFoldersDirectoriesToProcess.FindByPredicate([&Path](const auto& Directory)
-        {
-            return Path.StartsWith(Directory.Path);
-        }) != nullptr;
+        const bool bCanProcessFolder = NonGameFoldersDirectoriesToProcessIndex.MatchesAnyPrefix(Path)
+            || NonGameFoldersDirectoriesToProcessTokenMatcher.ContainsAny(Path);
 
         if (!bCanProcessFolder)
         {
-            bCanProcessFolder = NonGameFoldersDirectoriesToProcessContainingToken.FindByPredicate([&Path](const auto& Token) {
-                return Path.Contains(Token);
-            }) != nullptr;
+            return true;
         }
+    }
 
-        if (!bCanProcessFolder)
+    if (Path.StartsWith(TEXT("/Game/Developers/")) && !bAllowValidationInDevelopersFolder)
+    {
+        return true;
+    }
+
+    return ExcludedDirectoriesIndex.MatchesAnyPrefix(Path);
+}
+
+bool UNamingConventionValidationSettings::IsPathExcludedFromValidation(const FName PackageName) const
+{
+    const FNameBuilder PackageNameBuilder(PackageName);
+    return IsPathExcludedFromValidation(PackageNameBuilder.ToView());
+}
+
+void UNamingConventionValidationSettings::PostProcessSettings()
+{
+    OnSettingsChanging.Broadcast();
+
+    ClassDescriptions.Sort();
+    BuildClassDescriptionMatchers();
+
+    static const FDirectoryPath EngineDirectoryPath({ TEXT("/Engine/") });
+
+    // Cannot use AddUnique since FDirectoryPath does not have operator==
+    if (!ExcludedDirectories.ContainsByPredicate([](const FDirectoryPath& Item)
+    {
+        return Item.Path == EngineDirectoryPath.Path;
+    }))
+    {
+        ExcludedDirectories.Add(EngineDirectoryPath);
+    }
+
+    BuildPathIndices();
+    BuildFolderRulesIndex();
+
+    FWriteScopeLock WriteLock(ClassVerdictCacheLock);
+    ++RulesGeneration;
+    bAreRulesCompiled = false;
+    bIsClassAncestryIndexValid = false;
+    ClassVerdictCache.Reset();
+    ClassVerdictCacheHits = 0;
+    ClassVerdictCacheMisses = 0;
+}
+
+void UNamingConventionValidationSettings::BuildPathIndices()
+{
+    ExcludedDirectoriesIndex.Reset();
+    for (const FDirectoryPath& ExcludedDirectory : ExcludedDirectories)
+    {
+        ExcludedDirectoriesIndex.Add(ExcludedDirectory.Path);
+    }
+
+    NonGameFoldersDirectoriesToProcessIndex.Reset();
+    for (const FDirectoryPath& Directory : NonGameFoldersDirectoriesToProcess)
+    {
+        NonGameFoldersDirectoriesToProcessIndex.Add(Directory.Path);
+    }
+
+    NonGameFoldersDirectoriesToProcessTokenMatcher.Reset();
+    for (const FString& Token : NonGameFoldersDirectoriesToProcessContainingToken)
+    {
+        NonGameFoldersDirectoriesToProcessTokenMatcher.Add(Token);
+    }
+    NonGameFoldersDirectoriesToProcessTokenMatcher.Compile();
+}
+
+void UNamingConventionValidationSettings::BuildFolderRulesIndex()
+{
+    FolderRulesIndex.Reset();
+    FolderRuleKeywordMatchers.SetNum(FolderRules.Num());
+
+    for (int32 FolderRuleIndex = 0; FolderRuleIndex < FolderRules.Num(); ++FolderRuleIndex)
+    {
+        const FNamingConventionValidationFolderRule& FolderRule = FolderRules[FolderRuleIndex];
+
+        FString FolderPath = FolderRule.Folder.Path;
+        FolderPath.RemoveFromEnd(TEXT("**"));
+        FolderPath.RemoveFromEnd(TEXT("/"));
+        UE_CLOG(FolderPath.IsEmpty(), LogNamingConventionValidation, Warning, TEXT("The folder rule %d has no folder"), FolderRuleIndex);
+
+        if (!FolderPath.IsEmpty())
         {
-            return true;
+            FolderRulesIndex.Add(FolderPath + TEXT("/"), FolderRuleIndex);
         }
+
+        TArray<FString> Keywords;
+        FolderRule.RequiredKeywords.ParseIntoArray(Keywords, TEXT(";"), true);
+
+        FNamingConventionTokenMatcher& KeywordMatcher = FolderRuleKeywordMatchers[FolderRuleIndex];
+        KeywordMatcher.Reset();
+        for (const FString& Keyword : Keywords)
+        {
+            KeywordMatcher.Add(Keyword.TrimStartAndEnd());
+        }
+        KeywordMatcher.Compile();
     }
+}
 
-    if (Path.StartsWith("/Game/Developers/") && !bAllowValidationInDevelopersFolder)
+int32 UNamingConventionValidationSettings::FindFolderRuleIndex(const FName PackageName) const
+{
+    if (FolderRulesIndex.IsEmpty())
     {
+        return INDEX_NONE;
+    }
+
+    const FNameBuilder PackageNameBuilder(PackageName);
+
+    // The folders are visited from the root, the last one is the nearest
+    int32 FolderRuleIndex = INDEX_NONE;
+    FolderRulesIndex.ForEachPrefix(PackageNameBuilder.ToView(), [&FolderRuleIndex](const int32 Payload, int32 /*PrefixLength*/) {
+        FolderRuleIndex = Payload;
         return true;
+    });
+
+    return FolderRuleIndex;
+}
+
+const FNamingConventionTokenMatcher& UNamingConventionValidationSettings::GetFolderRuleKeywordMatcher(const int32 FolderRuleIndex) const
+{
+    return FolderRuleKeywordMatchers[FolderRuleIndex];
+}
+
+void UNamingConventionValidationSettings::CompileRules() const
+{
+    ClassDescriptionIndicesByClassPath.Reset();
+    for (int32 DescriptionIndex = 0; DescriptionIndex < ClassDescriptions.Num(); ++DescriptionIndex)
+    {
+        const FTopLevelAssetPath ClassPath = ClassDescriptions[DescriptionIndex].ClassPath.ToSoftObjectPath().GetAssetPath();
+        UE_CLOG(!ClassPath.IsValid(), LogNamingConventionValidation, Warning, TEXT("Impossible to get a valid class path for the class description %d"), DescriptionIndex);
+
+        if (ClassPath.IsValid())
+        {
+            // Indices are added in the sorted order of the descriptions
+            ClassDescriptionIndicesByClassPath.FindOrAdd(ClassPath).Add(DescriptionIndex);
+        }
     }
 
-    for (const FDirectoryPath& ExcludedPath : ExcludedDirectories)
+    ExcludedClassIndexByClassPath.Reset();
+    for (int32 ExcludedClassIndex = 0; ExcludedClassIndex < ExcludedClassPaths.Num(); ++ExcludedClassIndex)
     {
-        if (Path.StartsWith(ExcludedPath.Path))
+        const FTopLevelAssetPath ClassPath = ExcludedClassPaths[ExcludedClassIndex].ToSoftObjectPath().GetAssetPath();
+        UE_CLOG(!ClassPath.IsValid(), LogNamingConventionValidation, Warning, TEXT("Impossible to get a valid class path for the excluded class path %s"), *ExcludedClassPaths[ExcludedClassIndex].ToString());
+
+        if (ClassPath.IsValid())
         {
-            return true;
+            ExcludedClassIndexByClassPath.FindOrAdd(ClassPath, ExcludedClassIndex);
         }
     }
 
-    return false;
+    bAreRulesCompiled = true;
 }
 
-void UNamingConventionValidationSettings::PostProcessSettings()
+void UNamingConventionValidationSettings::BuildClassDescriptionMatchers()
 {
-    for (FNamingConventionValidationClassDescription& ClassDescription : ClassDescriptions)
+    ClassDescriptionMatchers.SetNum(ClassDescriptions.Num());
+
+    for (int32 DescriptionIndex = 0; DescriptionIndex < ClassDescriptions.Num(); ++DescriptionIndex)
     {
-        ClassDescription.Class = ClassDescription.ClassPath.LoadSynchronous();
-        UE_CLOG(ClassDescription.Class == nullptr, LogNamingConventionValidation, Warning, TEXT("Impossible to get a valid UClass for the class path %s"), *ClassDescription.ClassPath.ToString());
+        ClassDescriptionMatchers[DescriptionIndex].Prefix.Compile(ClassDescriptions[DescriptionIndex].Prefix, FNamingConventionAffixMatcher::EAffixType::Prefix);
+        ClassDescriptionMatchers[DescriptionIndex].Suffix.Compile(ClassDescriptions[DescriptionIndex].Suffix, FNamingConventionAffixMatcher::EAffixType::Suffix);
+        ClassDescriptionMatchers[DescriptionIndex].Pattern.Compile(ClassDescriptions[DescriptionIndex].Pattern, ClassDescriptions[DescriptionIndex].PatternSyntax);
     }
+}
 
-    ClassDescriptions.Sort();
+const FNamingConventionValidationClassDescriptionMatchers& UNamingConventionValidationSettings::GetClassDescriptionMatchers(const int32 DescriptionIndex) const
+{
+    return ClassDescriptionMatchers[DescriptionIndex];
+}
 
-    for (TSoftClassPtr<UObject>& ExcludedClassPath : ExcludedClassPaths)
+FNamingConventionValidationClassVerdict UNamingConventionValidationSettings::GetClassVerdict(const UClass* AssetClass) const
+{
+    return FindOrAddClassVerdict(AssetClass->GetClassPathName(), AssetClass);
+}
+
+FNamingConventionValidationClassVerdict UNamingConventionValidationSettings::GetClassVerdict(const FTopLevelAssetPath& ClassPath) const
+{
+    return FindOrAddClassVerdict(ClassPath, nullptr);
+}
+
+FNamingConventionValidationClassVerdict UNamingConventionValidationSettings::GetClassVerdictFromHierarchy(const TConstArrayView<FTopLevelAssetPath> ClassHierarchy) const
+{
     {
-        UClass* ExcludedClass = ExcludedClassPath.LoadSynchronous();
-        UE_CLOG(ExcludedClass == nullptr, LogNamingConventionValidation, Warning, TEXT("Impossible to get a valid UClass for the excluded class path %s"), *ExcludedClassPath.ToString());
+        FWriteScopeLock WriteLock(ClassVerdictCacheLock);
+        if (!bAreRulesCompiled)
+        {
+            CompileRules();
+        }
+    }
 
-        if (IsValid(ExcludedClass))
+    return ComputeClassVerdict(ClassHierarchy);
+}
+
+FNamingConventionValidationClassVerdict UNamingConventionValidationSettings::FindOrAddClassVerdict(const FTopLevelAssetPath& ClassPath, const UClass* AssetClass) const
+{
+    {
+        FReadScopeLock ReadLock(ClassVerdictCacheLock);
+        if (const FNamingConventionValidationClassVerdict* CachedVerdict = ClassVerdictCache.Find(ClassPath))
+        {
+            ++ClassVerdictCacheHits;
+            return *CachedVerdict;
+        }
+
+        // No rule applies to the classes missing from the index. Loaded classes are still checked, as the registry may not know about them
+        if (AssetClass == nullptr && bIsClassAncestryIndexValid)
         {
-            ExcludedClasses.Add(ExcludedClass);
+            ++ClassVerdictCacheHits;
+            return FNamingConventionValidationClassVerdict();
         }
     }
 
-    static const FDirectoryPath EngineDirectoryPath({ TEXT("/Engine/") });
+    ++ClassVerdictCacheMisses;
 
-    // Cannot use AddUnique since FDirectoryPath does not have operator==
-    if (!ExcludedDirectories.ContainsByPredicate([](const FDirectoryPath& Item)
+    uint32 VerdictRulesGeneration = 0;
     {
-        return Item.Path == EngineDirectoryPath.Path;
-    }))
+        FWriteScopeLock WriteLock(ClassVerdictCacheLock);
+        if (!bAreRulesCompiled)
+        {
+            CompileRules();
+        }
+
+        VerdictRulesGeneration = RulesGeneration;
+    }
+
+    FNamingConventionValidationClassVerdict Verdict = ComputeClassVerdict(ClassPath, AssetClass);
+
+    // The verdict is dropped if the rules changed while it was computed
+    FWriteScopeLock WriteLock(ClassVerdictCacheLock);
+    if (VerdictRulesGeneration == RulesGeneration)
     {
-        ExcludedDirectories.Add(EngineDirectoryPath);
+        ClassVerdictCache.Add(ClassPath, Verdict);
+    }
+    return Verdict;
+}
+
+void UNamingConventionValidationSettings::UpdateClassAncestryIndex() const
+{
+    FWriteScopeLock WriteLock(ClassVerdictCacheLock);
+
+    if (bIsClassAncestryIndexValid)
+    {
+        return;
+    }
+
+    if (!bAreRulesCompiled)
+    {
+        CompileRules();
+    }
+
+    const IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+    TSet<FTopLevelAssetPath> RuleClassPaths;
+    for (const TPair<FTopLevelAssetPath, TArray<int32, TInlineAllocator<2>>>& ClassDescriptionIndices : ClassDescriptionIndicesByClassPath)
+    {
+        RuleClassPaths.Add(ClassDescriptionIndices.Key);
+    }
+    for (const TPair<FTopLevelAssetPath, int32>& ExcludedClassIndex : ExcludedClassIndexByClassPath)
+    {
+        RuleClassPaths.Add(ExcludedClassIndex.Key);
+    }
+
+    // The classes of the rules are expanded from the root of the hierarchy to its leaves, so the descriptions of the deepest class overwrite the other ones
+    TArray<TPair<int32, FTopLevelAssetPath>> RuleClassPathsByDepth;
+    for (const FTopLevelAssetPath& RuleClassPath : RuleClassPaths)
+    {
+        TArray<FTopLevelAssetPath> AncestorClassPaths;
+        AssetRegistry.GetAncestorClassNames(RuleClassPath, AncestorClassPaths);
+        RuleClassPathsByDepth.Emplace(AncestorClassPaths.Num(), RuleClassPath);
+    }
+
+    RuleClassPathsByDepth.Sort([](const TPair<int32, FTopLevelAssetPath>& Lhs, const TPair<int32, FTopLevelAssetPath>& Rhs) {
+        return Lhs.Key < Rhs.Key;
+    });
+
+    ClassVerdictCache.Reset();
+
+    for (const TPair<int32, FTopLevelAssetPath>& RuleClassPath : RuleClassPathsByDepth)
+    {
+        TSet<FTopLevelAssetPath> DerivedClassPaths;
+        AssetRegistry.GetDerivedClassNames({ RuleClassPath.Value }, {}, DerivedClassPaths);
+        DerivedClassPaths.Add(RuleClassPath.Value);
+
+        const int32* ExcludedClassIndex = ExcludedClassIndexByClassPath.Find(RuleClassPath.Value);
+        const TArray<int32, TInlineAllocator<2>>* ClassDescriptionIndices = ClassDescriptionIndicesByClassPath.Find(RuleClassPath.Value);
+
+        for (const FTopLevelAssetPath& DerivedClassPath : DerivedClassPaths)
+        {
+            FNamingConventionValidationClassVerdict& Verdict = ClassVerdictCache.FindOrAdd(DerivedClassPath);
+
+            if (ExcludedClassIndex != nullptr)
+            {
+                Verdict.ExcludedClassIndex = Verdict.ExcludedClassIndex == INDEX_NONE ? *ExcludedClassIndex : FMath::Min(Verdict.ExcludedClassIndex, *ExcludedClassIndex);
+            }
+
+            if (ClassDescriptionIndices != nullptr)
+            {
+                Verdict.ClassDescriptionIndices = *ClassDescriptionIndices;
+            }
+        }
+    }
+
+    bIsClassAncestryIndexValid = true;
+
+    UE_LOG(LogNamingConventionValidation, Verbose, TEXT("Class ancestry index: %d rule classes expanded to %d classes"), RuleClassPaths.Num(), ClassVerdictCache.Num());
+}
+
+void UNamingConventionValidationSettings::InvalidateClassAncestryIndex() const
+{
+    FWriteScopeLock WriteLock(ClassVerdictCacheLock);
+    bIsClassAncestryIndexValid = false;
+}
+
+void UNamingConventionValidationSettings::GetClassVerdictCacheStats(int64& OutHits, int64& OutMisses) const
+{
+    OutHits = ClassVerdictCacheHits;
+    OutMisses = ClassVerdictCacheMisses;
+}
+
+FNamingConventionValidationClassVerdict UNamingConventionValidationSettings::ComputeClassVerdict(const FTopLevelAssetPath& ClassPath, const UClass* AssetClass) const
+{
+    // From the class itself to the root of its hierarchy
+    TArray<FTopLevelAssetPath, TInlineAllocator<16>> ClassHierarchy;
+
+    if (AssetClass != nullptr)
+    {
+        for (const UClass* Class = AssetClass; Class != nullptr; Class = Class->GetSuperClass())
+        {
+            ClassHierarchy.Add(Class->GetClassPathName());
+        }
+    }
+    else
+    {
+        ClassHierarchy.Add(ClassPath);
+
+        TArray<FTopLevelAssetPath> AncestorClassPaths;
+        IAssetRegistry::GetChecked().GetAncestorClassNames(ClassPath, AncestorClassPaths);
+        ClassHierarchy.Append(AncestorClassPaths);
     }
+
+    return ComputeClassVerdict(ClassHierarchy);
+}
+
+FNamingConventionValidationClassVerdict UNamingConventionValidationSettings::ComputeClassVerdict(const TConstArrayView<FTopLevelAssetPath> ClassHierarchy) const
+{
+    FNamingConventionValidationClassVerdict Verdict;
+
+    // The rules can be compiled again from the game thread while live validation runs in the background
+    FReadScopeLock ReadLock(ClassVerdictCacheLock);
+
+    for (const FTopLevelAssetPath& HierarchyClassPath : ClassHierarchy)
+    {
+        if (const int32* ExcludedClassIndex = ExcludedClassIndexByClassPath.Find(HierarchyClassPath))
+        {
+            Verdict.ExcludedClassIndex = Verdict.ExcludedClassIndex == INDEX_NONE ? *ExcludedClassIndex : FMath::Min(Verdict.ExcludedClassIndex, *ExcludedClassIndex);
+        }
+    }
+
+    if (Verdict.ExcludedClassIndex != INDEX_NONE)
+    {
+        return Verdict;
+    }
+
+    // Only the descriptions of the deepest class of the hierarchy which has some are relevant.
+    // Descriptions sharing that class are kept in their sorted order: the first one the asset name satisfies wins.
+    for (const FTopLevelAssetPath& HierarchyClassPath : ClassHierarchy)
+    {
+        if (const TArray<int32, TInlineAllocator<2>>* ClassDescriptionIndices = ClassDescriptionIndicesByClassPath.Find(HierarchyClassPath))
+        {
+            Verdict.ClassDescriptionIndices = *ClassDescriptionIndices;
+            break;
+        }
+    }
+
+    return Verdict;
 }
 
 void UNamingConventionValidationSettings::ResetValidatorClassDescriptionsToEpicDefaults()
@@ -131,6 +458,13 @@ void UNamingConventionValidationSettings::ResetValidatorClassDescriptionsToEpicD
 }
 
 #if WITH_EDITOR
+void UNamingConventionValidationSettings::PreEditChange(FProperty* PropertyAboutToChange)
+{
+    // The details panel edits the properties before PostEditChangeProperty rebuilds the indices
+    OnSettingsChanging.Broadcast();
+    Super::PreEditChange(PropertyAboutToChange);
+}
+
 void UNamingConventionValidationSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
     Super::PostEditChangeProperty(PropertyChangedEvent);
@@ -0,0 +1,208 @@
+#include "NamingConventionValidationSnapshotCommandlet.h"
+
+#include "NamingConventionSnapshotValidator.h"
+#include "NamingConventionValidationLog.h"
+#include "NamingConventionValidationReport.h"
+
+UNamingConventionValidationSnapshotCommandlet::UNamingConventionValidationSnapshotCommandlet()
+{
+    // Runs without the editor, so that neither the editor modules nor the scan of the asset registry slow down the start
+    IsClient = false;
+    IsEditor = false;
+    IsServer = false;
+    LogToConsole = false;
+}
+
+int32 UNamingConventionValidationSnapshotCommandlet::Main(const FString& Params)
+{
+    UE_LOG(LogNamingConventionValidation, Log, TEXT("--------------------------------------------------------------------------------------------"));
+    UE_LOG(LogNamingConventionValidation, Log, TEXT("Running NamingConventionValidationSnapshot Commandlet"));
+    TArray<FString> Tokens;
+    TArray<FString> Switches;
+    TMap<FString, FString> ParamsMap;
+    ParseCommandLine(*Params, Tokens, Switches, ParamsMap);
+
+    const FString* SnapshotParam = ParamsMap.Find(TEXT("Snapshot"));
+    if (SnapshotParam == nullptr)
+    {
+        UE_LOG(LogNamingConventionValidation, Error, TEXT("Missing -Snapshot=<path to AssetRegistry.bin or DevelopmentAssetRegistry.bin>"));
+        return 2;
+    }
+
+    TArray<FString> PackagePaths = { TEXT("/Game") };
+    if (const FString* PathsParam = ParamsMap.Find(TEXT("Paths")))
+    {
+        PackagePaths.Reset();
+        PathsParam->ParseIntoArray(PackagePaths, TEXT(","));
+    }
+
+    TArray<TUniquePtr<FNamingConventionValidationFileSink>> FileSinks;
+    if (const FString* ReportParam = ParamsMap.Find(TEXT("Report")))
+    {
+        if (!FNamingConventionValidationFileSink::CreateReportSinks(*ReportParam, FileSinks))
+        {
+            return 2;
+        }
+    }
+
+    TArray<INamingConventionValidationReportSink*> ReportSinks;
+    for (const TUniquePtr<FNamingConventionValidationFileSink>& FileSink : FileSinks)
+    {
+        ReportSinks.Add(FileSink.Get());
+    }
+
+    TOptional<FNamingConventionValidationMessageLogSink> MessageLogSink;
+    if (!Switches.Contains(TEXT("NoMessageLog")))
+    {
+        ReportSinks.Add(&MessageLogSink.Emplace(true));
+    }
+
+    FNamingConventionSnapshotValidator SnapshotValidator;
+    if (!SnapshotValidator.LoadSnapshot(*SnapshotParam))
+    {
+        return 2;
+    }
+
+    if (const FString* BaseSnapshotParam = ParamsMap.Find(TEXT("BaseSnapshot")))
+    {
+        TArray<TUniquePtr<FNamingConventionValidationFileSink>> FixedFileSinks;
+        if (const FString* FixedReportParam = ParamsMap.Find(TEXT("FixedReport")))
+        {
+            if (!FNamingConventionValidationFileSink::CreateReportSinks(*FixedReportParam, FixedFileSinks))
+            {
+                return 2;
+            }
+        }
+
+        TArray<INamingConventionValidationReportSink*> FixedReportSinks;
+        for (const TUniquePtr<FNamingConventionValidationFileSink>& FixedFileSink : FixedFileSinks)
+        {
+            FixedReportSinks.Add(FixedFileSink.Get());
+        }
+
+        return ValidateDelta(*BaseSnapshotParam, SnapshotValidator, PackagePaths, ReportSinks, FixedReportSinks) ? 0 : 2;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    TArray<const FAssetData*> Assets;
+    SnapshotValidator.GetAssets(PackagePaths, Assets);
+    const FNamingConventionValidationSummary Summary = SnapshotValidator.ValidateAssets(Assets, ReportSinks);
+
+    UE_LOG(LogNamingConventionValidation, Display, TEXT("Validated %d assets in %.2f s: %d valid, %d invalid, %d without rules, %d skipped"),
+        Summary.NumFilesToValidate, FPlatformTime::Seconds() - StartTime, Summary.NumValidFiles, Summary.NumInvalidFiles, Summary.NumFilesUnableToValidate, Summary.NumFilesSkipped);
+
+    UE_LOG(LogNamingConventionValidation, Log, TEXT("Successfully finished running NamingConventionValidationSnapshot Commandlet"));
+    UE_LOG(LogNamingConventionValidation, Log, TEXT("--------------------------------------------------------------------------------------------"));
+    return 0;
+}
+
+bool UNamingConventionValidationSnapshotCommandlet::ValidateDelta(const FString& BaseSnapshotFilename, const FNamingConventionSnapshotValidator& SnapshotValidator, const TArray<FString>& PackagePaths,
+    const TConstArrayView<INamingConventionValidationReportSink*> ReportSinks, const TConstArrayView<INamingConventionValidationReportSink*> FixedReportSinks)
+{
+    FNamingConventionSnapshotValidator BaseSnapshotValidator;
+    if (!BaseSnapshotValidator.LoadSnapshot(BaseSnapshotFilename))
+    {
+        return false;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    TArray<const FAssetData*> BaseAssets;
+    TArray<const FAssetData*> Assets;
+    BaseSnapshotValidator.GetAssets(PackagePaths, BaseAssets);
+    SnapshotValidator.GetAssets(PackagePaths, Assets);
+
+    TArray<const FAssetData*> RemovedAssets;
+    TArray<const FAssetData*> AddedAssets;
+    TArray<TPair<const FAssetData*, const FAssetData*>> RenamedAssets;
+    FNamingConventionSnapshotValidator::DiffAssets(BaseAssets, Assets, RemovedAssets, AddedAssets);
+    FNamingConventionSnapshotValidator::PairRenamedAssets(RemovedAssets, AddedAssets, RenamedAssets);
+
+    const double DiffTime = FPlatformTime::Seconds();
+
+    for (INamingConventionValidationReportSink* ReportSink : ReportSinks)
+    {
+        ReportSink->BeginReport();
+    }
+
+    for (INamingConventionValidationReportSink* FixedReportSink : FixedReportSinks)
+    {
+        FixedReportSink->BeginReport();
+    }
+
+    // Only the violations are reported: the new ones as found in the snapshot, the fixed ones as they were in the base snapshot
+    FNamingConventionValidationSummary NewViolationsSummary;
+    FNamingConventionValidationSummary FixedViolationsSummary;
+
+    const auto AddViolation = [](const TConstArrayView<INamingConventionValidationReportSink*> Sinks, FNamingConventionValidationSummary& Summary, const FAssetData& AssetData, const FNamingConventionValidationMessage& Message) {
+        Summary.AddResult(ENamingConventionValidationResult::Invalid);
+
+        for (INamingConventionValidationReportSink* Sink : Sinks)
+        {
+            Sink->AddResult(AssetData, ENamingConventionValidationResult::Invalid, Message);
+        }
+    };
+
+    FNamingConventionValidationMessage BaseMessage;
+    FNamingConventionValidationMessage Message;
+
+    for (const FAssetData* AddedAsset : AddedAssets)
+    {
+        if (SnapshotValidator.ValidateAsset(Message, *AddedAsset) == ENamingConventionValidationResult::Invalid)
+        {
+            AddViolation(ReportSinks, NewViolationsSummary, *AddedAsset, Message);
+        }
+    }
+
+    // A deleted asset did not get fixed: its violation is only counted, so that the fixed reports hold the assets which now follow the rules
+    int32 NumRemovedViolations = 0;
+
+    for (const FAssetData* RemovedAsset : RemovedAssets)
+    {
+        if (BaseSnapshotValidator.ValidateAsset(BaseMessage, *RemovedAsset) == ENamingConventionValidationResult::Invalid)
+        {
+            ++NumRemovedViolations;
+        }
+    }
+
+    // A renamed asset which breaks the rules before and after the rename keeps its violation, which is neither new nor fixed
+    int32 NumKeptViolations = 0;
+
+    for (const TPair<const FAssetData*, const FAssetData*>& RenamedAsset : RenamedAssets)
+    {
+        const bool bWasInvalid = BaseSnapshotValidator.ValidateAsset(BaseMessage, *RenamedAsset.Key) == ENamingConventionValidationResult::Invalid;
+        const bool bIsInvalid = SnapshotValidator.ValidateAsset(Message, *RenamedAsset.Value) == ENamingConventionValidationResult::Invalid;
+
+        if (bIsInvalid && !bWasInvalid)
+        {
+            AddViolation(ReportSinks, NewViolationsSummary, *RenamedAsset.Value, Message);
+        }
+        else if (bWasInvalid && !bIsInvalid)
+        {
+            AddViolation(FixedReportSinks, FixedViolationsSummary, *RenamedAsset.Key, BaseMessage);
+        }
+        else if (bWasInvalid)
+        {
+            ++NumKeptViolations;
+        }
+    }
+
+    NewViolationsSummary.NumFilesToValidate = NewViolationsSummary.NumInvalidFiles;
+    FixedViolationsSummary.NumFilesToValidate = FixedViolationsSummary.NumInvalidFiles;
+
+    for (INamingConventionValidationReportSink* ReportSink : ReportSinks)
+    {
+        ReportSink->EndReport(NewViolationsSummary);
+    }
+
+    for (INamingConventionValidationReportSink* FixedReportSink : FixedReportSinks)
+    {
+        FixedReportSink->EndReport(FixedViolationsSummary);
+    }
+
+    UE_LOG(LogNamingConventionValidation, Display, TEXT("%d assets removed, %d added and %d renamed, out of %d, found in %.2f s"), RemovedAssets.Num(), AddedAssets.Num(), RenamedAssets.Num(), Assets.Num(), DiffTime - StartTime);
+    UE_LOG(LogNamingConventionValidation, Display, TEXT("%d new violations, %d fixed violations, %d violations removed with their assets, %d violations kept by renamed assets, validated in %.2f s"),
+        NewViolationsSummary.NumInvalidFiles, FixedViolationsSummary.NumInvalidFiles, NumRemovedViolations, NumKeptViolations, FPlatformTime::Seconds() - DiffTime);
+    return true;
+}
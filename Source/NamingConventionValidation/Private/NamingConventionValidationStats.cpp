@@ -0,0 +1,21 @@
+#include "NamingConventionValidationStats.h"
+
+UE_TRACE_CHANNEL_DEFINE( NamingConventionValidationChannel )
+
+DEFINE_STAT( STAT_NamingConventionValidation_ValidateAssets );
+DEFINE_STAT( STAT_NamingConventionValidation_PathExclusion );
+DEFINE_STAT( STAT_NamingConventionValidation_ClassResolution );
+DEFINE_STAT( STAT_NamingConventionValidation_AssetLoad );
+DEFINE_STAT( STAT_NamingConventionValidation_ClassLoad );
+DEFINE_STAT( STAT_NamingConventionValidation_ClassDescriptions );
+DEFINE_STAT( STAT_NamingConventionValidation_Validators );
+DEFINE_STAT( STAT_NamingConventionValidation_MessageLog );
+DEFINE_STAT( STAT_NamingConventionValidation_ValidateOnSave );
+DEFINE_STAT( STAT_NamingConventionValidation_RegisterValidators );
+
+DEFINE_STAT( STAT_NamingConventionValidation_AssetsValidated );
+DEFINE_STAT( STAT_NamingConventionValidation_AssetsLoaded );
+DEFINE_STAT( STAT_NamingConventionValidation_ClassesLoaded );
+
+TRACE_DECLARE_INT_COUNTER( NamingConventionValidation_AssetsLoaded, TEXT( "NamingConventionValidation/AssetsLoaded" ) );
+TRACE_DECLARE_INT_COUNTER( NamingConventionValidation_ClassesLoaded, TEXT( "NamingConventionValidation/ClassesLoaded" ) );
@@ -0,0 +1,442 @@
+#include "NamingConventionValidationStringMatchers.h"
+
+#include "Algo/BinarySearch.h"
+
+namespace NamingConventionStringMatchers
+{
+    template <typename NodeType>
+    int32 FindChild(const NodeType& Node, const TCHAR Character)
+    {
+        const TCHAR LowerCharacter = FChar::ToLower(Character);
+        const int32 ChildIndex = Algo::LowerBoundBy(Node.Children, LowerCharacter, [](const TPair<TCHAR, int32>& Child) {
+            return Child.Key;
+        });
+
+        return Node.Children.IsValidIndex(ChildIndex) && Node.Children[ChildIndex].Key == LowerCharacter
+            ? Node.Children[ChildIndex].Value
+            : INDEX_NONE;
+    }
+
+    bool IsRegexMetaCharacter(const TCHAR Character)
+    {
+        return FCString::Strchr(TEXT("\\^$.|?*+()[]{}"), Character) != nullptr;
+    }
+
+    bool IsRegexQuantifier(const TCHAR Character)
+    {
+        return Character == TEXT('*') || Character == TEXT('+') || Character == TEXT('?') || Character == TEXT('{');
+    }
+
+    // Only plain characters are kept, the prefix and suffix are empty as soon as the pattern is not simple enough to be sure of them:
+    // inline flags and quoting can change how the literals match, and an alternation outside of a group makes them optional
+    void GetRegexLiterals(FStringView Pattern, FString& OutPrefix, FString& OutSuffix)
+    {
+        OutPrefix.Reset();
+        OutSuffix.Reset();
+
+        if (Pattern.Contains(TEXT("(?")) || Pattern.Contains(TEXT("\\Q")))
+        {
+            return;
+        }
+
+        int32 GroupDepth = 0;
+        for (int32 CharIndex = 0; CharIndex < Pattern.Len(); ++CharIndex)
+        {
+            const TCHAR Character = Pattern[CharIndex];
+            if (Character == TEXT('\\'))
+            {
+                ++CharIndex;
+            }
+            else if (Character == TEXT('['))
+            {
+                // Skips the character class. A ']' right after the opening bracket or its negation is part of the class
+                int32 ClassIndex = CharIndex + 1;
+                ClassIndex += ClassIndex < Pattern.Len() && Pattern[ClassIndex] == TEXT('^') ? 1 : 0;
+                ClassIndex += ClassIndex < Pattern.Len() && Pattern[ClassIndex] == TEXT(']') ? 1 : 0;
+
+                while (ClassIndex < Pattern.Len() && Pattern[ClassIndex] != TEXT(']'))
+                {
+                    ClassIndex += Pattern[ClassIndex] == TEXT('\\') ? 2 : 1;
+                }
+
+                CharIndex = ClassIndex;
+            }
+            else if (Character == TEXT('('))
+            {
+                ++GroupDepth;
+            }
+            else if (Character == TEXT(')'))
+            {
+                --GroupDepth;
+            }
+            else if (Character == TEXT('|') && GroupDepth == 0)
+            {
+                return;
+            }
+        }
+
+        if (Pattern.StartsWith(TEXT('^')))
+        {
+            Pattern.RightChopInline(1);
+        }
+
+        if (Pattern.EndsWith(TEXT('$')) && !Pattern.EndsWith(TEXT("\\$")))
+        {
+            Pattern.LeftChopInline(1);
+        }
+
+        int32 PrefixLength = 0;
+        while (PrefixLength < Pattern.Len() && !IsRegexMetaCharacter(Pattern[PrefixLength]))
+        {
+            ++PrefixLength;
+        }
+
+        // The last character is optional or repeated when a quantifier follows it
+        if (PrefixLength > 0 && PrefixLength < Pattern.Len() && IsRegexQuantifier(Pattern[PrefixLength]))
+        {
+            --PrefixLength;
+        }
+
+        // The suffix does not overlap the prefix, or a fully literal pattern would require twice its length
+        int32 SuffixStart = Pattern.Len();
+        while (SuffixStart > PrefixLength && !IsRegexMetaCharacter(Pattern[SuffixStart - 1]))
+        {
+            --SuffixStart;
+        }
+
+        // The first character of the suffix is an escape sequence when a backslash precedes it
+        if (SuffixStart > 0 && SuffixStart < Pattern.Len() && Pattern[SuffixStart - 1] == TEXT('\\'))
+        {
+            ++SuffixStart;
+        }
+
+        OutPrefix = Pattern.Left(PrefixLength);
+        OutSuffix = Pattern.RightChop(SuffixStart);
+    }
+
+    void GetWildcardLiterals(const FStringView Pattern, FString& OutPrefix, FString& OutSuffix)
+    {
+        int32 PrefixLength = 0;
+        while (PrefixLength < Pattern.Len() && Pattern[PrefixLength] != TEXT('*') && Pattern[PrefixLength] != TEXT('?'))
+        {
+            ++PrefixLength;
+        }
+
+        int32 SuffixStart = Pattern.Len();
+        while (SuffixStart > PrefixLength && Pattern[SuffixStart - 1] != TEXT('*') && Pattern[SuffixStart - 1] != TEXT('?'))
+        {
+            --SuffixStart;
+        }
+
+        OutPrefix = Pattern.Left(PrefixLength);
+        OutSuffix = Pattern.RightChop(SuffixStart);
+    }
+
+    // Returns the index of the child of Nodes[NodeIndex] for Character, creating it if needed
+    template <typename NodeType>
+    int32 FindOrAddChild(TArray<NodeType>& Nodes, const int32 NodeIndex, const TCHAR Character)
+    {
+        const TCHAR LowerCharacter = FChar::ToLower(Character);
+        const int32 ChildIndex = Algo::LowerBoundBy(Nodes[NodeIndex].Children, LowerCharacter, [](const TPair<TCHAR, int32>& Child) {
+            return Child.Key;
+        });
+
+        if (Nodes[NodeIndex].Children.IsValidIndex(ChildIndex) && Nodes[NodeIndex].Children[ChildIndex].Key == LowerCharacter)
+        {
+            return Nodes[NodeIndex].Children[ChildIndex].Value;
+        }
+
+        const int32 NewNodeIndex = Nodes.AddDefaulted();
+        Nodes[NodeIndex].Children.Insert(TPair<TCHAR, int32>(LowerCharacter, NewNodeIndex), ChildIndex);
+        return NewNodeIndex;
+    }
+}
+
+FNamingConventionPrefixTrie::FNamingConventionPrefixTrie()
+{
+    Reset();
+}
+
+void FNamingConventionPrefixTrie::Reset()
+{
+    Nodes.Reset();
+    Nodes.AddDefaulted();
+}
+
+void FNamingConventionPrefixTrie::Add(const FStringView Prefix, const int32 Payload)
+{
+    if (Prefix.IsEmpty())
+    {
+        return;
+    }
+
+    int32 NodeIndex = 0;
+    for (const TCHAR Character : Prefix)
+    {
+        NodeIndex = NamingConventionStringMatchers::FindOrAddChild(Nodes, NodeIndex, Character);
+    }
+
+    if (Nodes[NodeIndex].Payload == INDEX_NONE)
+    {
+        Nodes[NodeIndex].Payload = Payload;
+    }
+}
+
+void FNamingConventionPrefixTrie::AddReversed(const FStringView Suffix, const int32 Payload)
+{
+    if (Suffix.IsEmpty())
+    {
+        return;
+    }
+
+    int32 NodeIndex = 0;
+    for (int32 CharIndex = Suffix.Len() - 1; CharIndex >= 0; --CharIndex)
+    {
+        NodeIndex = NamingConventionStringMatchers::FindOrAddChild(Nodes, NodeIndex, Suffix[CharIndex]);
+    }
+
+    if (Nodes[NodeIndex].Payload == INDEX_NONE)
+    {
+        Nodes[NodeIndex].Payload = Payload;
+    }
+}
+
+bool FNamingConventionPrefixTrie::IsEmpty() const
+{
+    return Nodes.Num() <= 1;
+}
+
+bool FNamingConventionPrefixTrie::MatchesAnyPrefix(const FStringView Text) const
+{
+    bool bMatches = false;
+    ForEachPrefix(Text, [&bMatches](int32 /*Payload*/, int32 /*PrefixLength*/) {
+        bMatches = true;
+        return false;
+    });
+
+    return bMatches;
+}
+
+int32 FNamingConventionPrefixTrie::FindChild(const int32 NodeIndex, const TCHAR Character) const
+{
+    return NamingConventionStringMatchers::FindChild(Nodes[NodeIndex], Character);
+}
+
+FNamingConventionTokenMatcher::FNamingConventionTokenMatcher()
+{
+    Reset();
+}
+
+void FNamingConventionTokenMatcher::Reset()
+{
+    Nodes.Reset();
+    Nodes.AddDefaulted();
+}
+
+void FNamingConventionTokenMatcher::Add(const FStringView Token)
+{
+    if (Token.IsEmpty())
+    {
+        return;
+    }
+
+    int32 NodeIndex = 0;
+    for (const TCHAR Character : Token)
+    {
+        NodeIndex = NamingConventionStringMatchers::FindOrAddChild(Nodes, NodeIndex, Character);
+    }
+
+    Nodes[NodeIndex].bIsMatch = true;
+}
+
+void FNamingConventionTokenMatcher::Compile()
+{
+    // Breadth first traversal, so the failure link of a node is always computed before the ones of its children
+    TArray<int32> Queue;
+    Queue.Reserve(Nodes.Num());
+
+    for (const TPair<TCHAR, int32>& Child : Nodes[0].Children)
+    {
+        Nodes[Child.Value].Fail = 0;
+        Queue.Add(Child.Value);
+    }
+
+    for (int32 QueueIndex = 0; QueueIndex < Queue.Num(); ++QueueIndex)
+    {
+        const int32 NodeIndex = Queue[QueueIndex];
+
+        for (const TPair<TCHAR, int32>& Child : Nodes[NodeIndex].Children)
+        {
+            int32 FailIndex = Nodes[NodeIndex].Fail;
+            int32 FailChildIndex = FindChild(FailIndex, Child.Key);
+
+            while (FailChildIndex == INDEX_NONE && FailIndex != 0)
+            {
+                FailIndex = Nodes[FailIndex].Fail;
+                FailChildIndex = FindChild(FailIndex, Child.Key);
+            }
+
+            Nodes[Child.Value].Fail = FailChildIndex != INDEX_NONE ? FailChildIndex : 0;
+            Nodes[Child.Value].bIsMatch |= Nodes[Nodes[Child.Value].Fail].bIsMatch;
+            Queue.Add(Child.Value);
+        }
+    }
+}
+
+bool FNamingConventionTokenMatcher::IsEmpty() const
+{
+    return Nodes.Num() <= 1;
+}
+
+bool FNamingConventionTokenMatcher::ContainsAny(const FStringView Text) const
+{
+    if (IsEmpty())
+    {
+        return false;
+    }
+
+    int32 NodeIndex = 0;
+    for (const TCHAR Character : Text)
+    {
+        int32 ChildIndex = FindChild(NodeIndex, Character);
+        while (ChildIndex == INDEX_NONE && NodeIndex != 0)
+        {
+            NodeIndex = Nodes[NodeIndex].Fail;
+            ChildIndex = FindChild(NodeIndex, Character);
+        }
+
+        NodeIndex = ChildIndex != INDEX_NONE ? ChildIndex : 0;
+        if (Nodes[NodeIndex].bIsMatch)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+int32 FNamingConventionTokenMatcher::FindChild(const int32 NodeIndex, const TCHAR Character) const
+{
+    return NamingConventionStringMatchers::FindChild(Nodes[NodeIndex], Character);
+}
+
+void FNamingConventionAffixMatcher::Compile(const FString& AffixList, const EAffixType InAffixType)
+{
+    AffixType = InAffixType;
+    Trie.Reset();
+    Alternatives.Reset();
+
+    AffixList.ParseIntoArray(Alternatives, TEXT(";"), true);
+
+    for (int32 AlternativeIndex = 0; AlternativeIndex < Alternatives.Num(); ++AlternativeIndex)
+    {
+        Alternatives[AlternativeIndex].TrimStartAndEndInline();
+
+        if (AffixType == EAffixType::Prefix)
+        {
+            Trie.Add(Alternatives[AlternativeIndex], AlternativeIndex);
+        }
+        else
+        {
+            Trie.AddReversed(Alternatives[AlternativeIndex], AlternativeIndex);
+        }
+    }
+}
+
+bool FNamingConventionAffixMatcher::IsEmpty() const
+{
+    return Trie.IsEmpty();
+}
+
+int32 FNamingConventionAffixMatcher::FindMatch(const FStringView Name) const
+{
+    int32 MatchIndex = INDEX_NONE;
+    const auto Visitor = [&MatchIndex](const int32 AlternativeIndex, int32 /*AffixLength*/) {
+        MatchIndex = AlternativeIndex;
+        return true;
+    };
+
+    if (AffixType == EAffixType::Prefix)
+    {
+        Trie.ForEachPrefix(Name, Visitor);
+    }
+    else
+    {
+        Trie.ForEachSuffix(Name, Visitor);
+    }
+
+    return MatchIndex;
+}
+
+const TArray<FString>& FNamingConventionAffixMatcher::GetAlternatives() const
+{
+    return Alternatives;
+}
+
+void FNamingConventionPatternMatcher::Compile(const FString& InPattern, const ENamingConventionPatternSyntax InSyntax)
+{
+    Pattern = InPattern;
+    Syntax = InSyntax;
+    RegexPattern.Reset();
+    LiteralPrefix.Reset();
+    LiteralSuffix.Reset();
+
+    if (Pattern.IsEmpty())
+    {
+        return;
+    }
+
+    if (Syntax == ENamingConventionPatternSyntax::Regex)
+    {
+        // Anchored so that the whole name has to match, like the wildcards
+        RegexPattern.Emplace(FString::Printf(TEXT("^(?:%s)$"), *Pattern));
+        NamingConventionStringMatchers::GetRegexLiterals(Pattern, LiteralPrefix, LiteralSuffix);
+    }
+    else
+    {
+        NamingConventionStringMatchers::GetWildcardLiterals(Pattern, LiteralPrefix, LiteralSuffix);
+    }
+}
+
+bool FNamingConventionPatternMatcher::IsEmpty() const
+{
+    return Pattern.IsEmpty();
+}
+
+bool FNamingConventionPatternMatcher::Matches(const FString& Name) const
+{
+    if (Pattern.IsEmpty())
+    {
+        return true;
+    }
+
+    const ESearchCase::Type SearchCase = Syntax == ENamingConventionPatternSyntax::Regex ? ESearchCase::CaseSensitive : ESearchCase::IgnoreCase;
+
+    if (Name.Len() < LiteralPrefix.Len() + LiteralSuffix.Len() || !Name.StartsWith(LiteralPrefix, SearchCase) || !Name.EndsWith(LiteralSuffix, SearchCase))
+    {
+        return false;
+    }
+
+    if (Syntax == ENamingConventionPatternSyntax::Wildcard)
+    {
+        return Name.MatchesWildcard(Pattern, ESearchCase::IgnoreCase);
+    }
+
+    FRegexMatcher RegexMatcher(RegexPattern.GetValue(), Name);
+    return RegexMatcher.FindNext();
+}
+
+const FString& FNamingConventionPatternMatcher::GetPattern() const
+{
+    return Pattern;
+}
+
+const FString& FNamingConventionPatternMatcher::GetLiteralPrefix() const
+{
+    return LiteralPrefix;
+}
+
+const FString& FNamingConventionPatternMatcher::GetLiteralSuffix() const
+{
+    return LiteralSuffix;
+}
@@ -0,0 +1,94 @@
+#include "NamingConventionValidationTypes.h"
+
+#include "NamingConventionValidationSettings.h"
+
+#define LOCTEXT_NAMESPACE "NamingConventionValidationManager"
+
+namespace NamingConventionValidationTypes
+{
+    FText GetAffixAlternativesText(const FNamingConventionAffixMatcher& Matcher)
+    {
+        const TArray<FString>& Alternatives = Matcher.GetAlternatives();
+        if (Alternatives.Num() == 1)
+        {
+            return FText::FromString(Alternatives[0]);
+        }
+
+        return FText::Format(LOCTEXT("AffixAlternatives", "one of {0}"), FText::FromString(FString::Join(Alternatives, TEXT(", "))));
+    }
+}
+
+FNamingConventionValidationMessage::FNamingConventionValidationMessage(const ENamingConventionValidationRule InRule, const int32 InRuleArgument) :
+    Rule(InRule),
+    RuleArgument(InRuleArgument)
+{
+}
+
+FText FNamingConventionValidationMessage::ToText() const
+{
+    if (!Text.IsEmpty())
+    {
+        return Text;
+    }
+
+    const UNamingConventionValidationSettings* Settings = GetDefault<UNamingConventionValidationSettings>();
+
+    switch (Rule)
+    {
+    case ENamingConventionValidationRule::ExcludedDirectory:
+        return LOCTEXT("ExcludedFolder", "The asset is in an excluded directory");
+    case ENamingConventionValidationRule::ExcludedClass:
+        if (Settings->ExcludedClassPaths.IsValidIndex(RuleArgument))
+        {
+            return FText::Format(LOCTEXT("ExcludedClass", "Assets of class '{0}' are excluded from naming convention validation"), FText::FromString(Settings->ExcludedClassPaths[RuleArgument].GetAssetName()));
+        }
+        break;
+    case ENamingConventionValidationRule::Deferred:
+        return LOCTEXT("DeferredClass", "The class of the asset cannot be resolved without loading it");
+    case ENamingConventionValidationRule::UnknownClass:
+        return LOCTEXT("UnknownClass", "The asset is of a class which has not been set up in the settings");
+    case ENamingConventionValidationRule::WrongPrefix:
+        if (Settings->ClassDescriptions.IsValidIndex(RuleArgument))
+        {
+            const FNamingConventionValidationClassDescription& ClassDescription = Settings->ClassDescriptions[RuleArgument];
+            const FNamingConventionAffixMatcher& PrefixMatcher = Settings->GetClassDescriptionMatchers(RuleArgument).Prefix;
+            return FText::Format(LOCTEXT("WrongPrefix", "Assets of class '{0}' must have a name which starts with {1}"), FText::FromString(ClassDescription.ClassPath.ToString()), NamingConventionValidationTypes::GetAffixAlternativesText(PrefixMatcher));
+        }
+        break;
+    case ENamingConventionValidationRule::WrongSuffix:
+        if (Settings->ClassDescriptions.IsValidIndex(RuleArgument))
+        {
+            const FNamingConventionValidationClassDescription& ClassDescription = Settings->ClassDescriptions[RuleArgument];
+            const FNamingConventionAffixMatcher& SuffixMatcher = Settings->GetClassDescriptionMatchers(RuleArgument).Suffix;
+            return FText::Format(LOCTEXT("WrongSuffix", "Assets of class '{0}' must have a name which ends with {1}"), FText::FromString(ClassDescription.ClassPath.ToString()), NamingConventionValidationTypes::GetAffixAlternativesText(SuffixMatcher));
+        }
+        break;
+    case ENamingConventionValidationRule::WrongPattern:
+        if (Settings->ClassDescriptions.IsValidIndex(RuleArgument))
+        {
+            const FNamingConventionValidationClassDescription& ClassDescription = Settings->ClassDescriptions[RuleArgument];
+            return FText::Format(LOCTEXT("WrongPattern", "Assets of class '{0}' must have a name which matches {1}"), FText::FromString(ClassDescription.ClassPath.ToString()), FText::FromString(ClassDescription.Pattern));
+        }
+        break;
+    case ENamingConventionValidationRule::FolderKeyword:
+        if (Settings->FolderRules.IsValidIndex(RuleArgument))
+        {
+            const FNamingConventionValidationFolderRule& FolderRule = Settings->FolderRules[RuleArgument];
+            return FText::Format(LOCTEXT("FolderKeyword", "Assets in '{0}' must have a name which contains one of {1}"), FText::FromString(FolderRule.Folder.Path), FText::FromString(FolderRule.RequiredKeywords.Replace(TEXT(";"), TEXT(", "))));
+        }
+        break;
+    case ENamingConventionValidationRule::BlueprintPrefix:
+        return FText::FromString(TEXT("Generic blueprint assets must start with BP_"));
+    default:
+        break;
+    }
+
+    return Text;
+}
+
+void FNamingConventionValidationMessage::Resolve()
+{
+    Text = ToText();
+}
+
+#undef LOCTEXT_NAMESPACE
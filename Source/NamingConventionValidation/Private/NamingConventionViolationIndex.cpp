@@ -0,0 +1,200 @@
+#include "NamingConventionViolationIndex.h"
+
+#include "AssetRegistry/AssetData.h"
+
+namespace NamingConventionViolationIndex
+{
+    // Returns NAME_None for the root folders, such as /Game
+    FName GetParentFolderPath(const FName FolderPath)
+    {
+        const FNameBuilder FolderPathBuilder(FolderPath);
+        const FStringView FolderPathView = FolderPathBuilder.ToView();
+
+        int32 SlashIndex = INDEX_NONE;
+        if (FolderPathView.FindLastChar(TEXT('/'), SlashIndex) && SlashIndex > 0)
+        {
+            return FName(FolderPathView.Left(SlashIndex));
+        }
+
+        return NAME_None;
+    }
+}
+
+void FNamingConventionViolationIndex::Update(const FAssetData& AssetData, const ENamingConventionValidationResult Result, const FNamingConventionValidationMessage& Message)
+{
+    FSoftObjectPath AssetPath = AssetData.GetSoftObjectPath();
+    Remove(AssetPath);
+
+    if (Result == ENamingConventionValidationResult::Invalid)
+    {
+        AddViolation({ MoveTemp(AssetPath), AssetData.PackageName, AssetData.PackagePath, AssetData.AssetClassPath, Message });
+    }
+}
+
+void FNamingConventionViolationIndex::Remove(const FSoftObjectPath& AssetPath)
+{
+    if (const FViolation* Violation = Violations.Find(AssetPath))
+    {
+        RemoveViolation(*Violation);
+        Violations.Remove(AssetPath);
+    }
+}
+
+void FNamingConventionViolationIndex::Reset()
+{
+    Violations.Reset();
+    Folders.Reset();
+    AssetPathsByClass.Reset();
+}
+
+void FNamingConventionViolationIndex::ResolveMessages()
+{
+    for (TPair<FSoftObjectPath, FViolation>& Violation : Violations)
+    {
+        Violation.Value.Message.Resolve();
+    }
+}
+
+int32 FNamingConventionViolationIndex::Num() const
+{
+    return Violations.Num();
+}
+
+bool FNamingConventionViolationIndex::Contains(const FSoftObjectPath& AssetPath) const
+{
+    return Violations.Contains(AssetPath);
+}
+
+const FNamingConventionViolationIndex::FViolation* FNamingConventionViolationIndex::Find(const FSoftObjectPath& AssetPath) const
+{
+    return Violations.Find(AssetPath);
+}
+
+int32 FNamingConventionViolationIndex::GetNumViolationsInFolder(const FName FolderPath) const
+{
+    const FFolder* Folder = Folders.Find(FolderPath);
+    return Folder != nullptr ? Folder->NumViolations : 0;
+}
+
+int32 FNamingConventionViolationIndex::GetNumViolationsOfClass(const FTopLevelAssetPath& AssetClassPath) const
+{
+    const TSet<FSoftObjectPath>* AssetPaths = AssetPathsByClass.Find(AssetClassPath);
+    return AssetPaths != nullptr ? AssetPaths->Num() : 0;
+}
+
+void FNamingConventionViolationIndex::GetViolationsInFolder(const FName FolderPath, TArray<const FViolation*>& OutViolations) const
+{
+    if (const FFolder* Folder = Folders.Find(FolderPath))
+    {
+        OutViolations.Reserve(OutViolations.Num() + Folder->NumViolations);
+        GetViolationsInFolder(*Folder, OutViolations);
+    }
+}
+
+void FNamingConventionViolationIndex::GetViolationsOfClass(const FTopLevelAssetPath& AssetClassPath, TArray<const FViolation*>& OutViolations) const
+{
+    if (const TSet<FSoftObjectPath>* AssetPaths = AssetPathsByClass.Find(AssetClassPath))
+    {
+        OutViolations.Reserve(OutViolations.Num() + AssetPaths->Num());
+
+        for (const FSoftObjectPath& AssetPath : *AssetPaths)
+        {
+            OutViolations.Add(&Violations.FindChecked(AssetPath));
+        }
+    }
+}
+
+void FNamingConventionViolationIndex::ForEachFolder(const TFunctionRef<void(FName FolderPath, int32 NumViolations)> Visitor) const
+{
+    for (const TPair<FName, FFolder>& Folder : Folders)
+    {
+        Visitor(Folder.Key, Folder.Value.NumViolations);
+    }
+}
+
+void FNamingConventionViolationIndex::AddViolation(FViolation&& Violation)
+{
+    // Only the folders holding violations have a node, which links to the nodes of its sub folders
+    FName SubFolderPath = NAME_None;
+
+    for (FName FolderPath = Violation.PackagePath; !FolderPath.IsNone(); FolderPath = NamingConventionViolationIndex::GetParentFolderPath(FolderPath))
+    {
+        FFolder& Folder = Folders.FindOrAdd(FolderPath);
+        ++Folder.NumViolations;
+
+        if (SubFolderPath.IsNone())
+        {
+            Folder.AssetPaths.Add(Violation.AssetPath);
+        }
+        else
+        {
+            Folder.SubFolderPaths.Add(SubFolderPath);
+        }
+
+        SubFolderPath = FolderPath;
+    }
+
+    AssetPathsByClass.FindOrAdd(Violation.AssetClassPath).Add(Violation.AssetPath);
+
+    const FSoftObjectPath AssetPath = Violation.AssetPath;
+    Violations.Add(AssetPath, MoveTemp(Violation));
+}
+
+void FNamingConventionViolationIndex::RemoveViolation(const FViolation& Violation)
+{
+    FName RemovedSubFolderPath = NAME_None;
+    bool bIsPackageFolder = true;
+
+    for (FName FolderPath = Violation.PackagePath; !FolderPath.IsNone(); FolderPath = NamingConventionViolationIndex::GetParentFolderPath(FolderPath))
+    {
+        FFolder* Folder = Folders.Find(FolderPath);
+        if (!ensure(Folder != nullptr))
+        {
+            break;
+        }
+
+        --Folder->NumViolations;
+
+        if (bIsPackageFolder)
+        {
+            Folder->AssetPaths.Remove(Violation.AssetPath);
+            bIsPackageFolder = false;
+        }
+
+        if (!RemovedSubFolderPath.IsNone())
+        {
+            Folder->SubFolderPaths.Remove(RemovedSubFolderPath);
+        }
+
+        RemovedSubFolderPath = NAME_None;
+
+        if (Folder->NumViolations == 0)
+        {
+            Folders.Remove(FolderPath);
+            RemovedSubFolderPath = FolderPath;
+        }
+    }
+
+    if (TSet<FSoftObjectPath>* AssetPaths = AssetPathsByClass.Find(Violation.AssetClassPath))
+    {
+        AssetPaths->Remove(Violation.AssetPath);
+
+        if (AssetPaths->IsEmpty())
+        {
+            AssetPathsByClass.Remove(Violation.AssetClassPath);
+        }
+    }
+}
+
+void FNamingConventionViolationIndex::GetViolationsInFolder(const FFolder& Folder, TArray<const FViolation*>& OutViolations) const
+{
+    for (const FSoftObjectPath& AssetPath : Folder.AssetPaths)
+    {
+        OutViolations.Add(&Violations.FindChecked(AssetPath));
+    }
+
+    for (const FName SubFolderPath : Folder.SubFolderPaths)
+    {
+        GetViolationsInFolder(Folders.FindChecked(SubFolderPath), OutViolations);
+    }
+}
@@ -0,0 +1,29 @@
+#include "NamingConventionValidationBenchmarkCommandlet.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNamingConventionValidationBenchmarkTest, "NamingConventionValidation.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FNamingConventionValidationBenchmarkTest::RunTest(const FString& /*Parameters*/)
+{
+    // Only the small sets, so that the test runs in a few seconds. The commandlet runs the large ones
+    TArray<FNamingConventionValidationBenchmarkResult> Results;
+    if (!UNamingConventionValidationBenchmarkCommandlet::RunBenchmarks({ 1000, 10000 }, 0.1, Results))
+    {
+        AddError(TEXT("The benchmark could not build its asset sets from the class descriptions of the settings"));
+        return false;
+    }
+
+    for (const FNamingConventionValidationBenchmarkResult& Result : Results)
+    {
+        AddInfo(FString::Printf(TEXT("%s with %d assets: %.0f assets/s, %.2f allocations/asset, %.1f allocated bytes/asset"), *Result.Benchmark, Result.NumAssets, Result.AssetsPerSecond, Result.AllocationsPerAsset, Result.AllocatedBytesPerAsset));
+    }
+
+    const FString BaselineFilename = UNamingConventionValidationBenchmarkCommandlet::GetDefaultBaselineFilename();
+    TestTrue(TEXT("The results meet the checked-in baseline"), UNamingConventionValidationBenchmarkCommandlet::CompareWithBaseline(Results, BaselineFilename, 0.2));
+    return true;
+}
+
+#endif
@@ -0,0 +1,171 @@
+#include "NamingConventionValidationStringMatchers.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNamingConventionPrefixTrieTest, "NamingConventionValidation.StringMatchers.PrefixTrie", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNamingConventionPrefixTrieTest::RunTest(const FString& /*Parameters*/)
+{
+    FNamingConventionPrefixTrie Trie;
+    Trie.Add(TEXT(""), 0);
+    TestTrue(TEXT("Empty strings are ignored"), Trie.IsEmpty());
+
+    Trie.Add(TEXT("T"), 0);
+    Trie.Add(TEXT("T_"), 1);
+    Trie.Add(TEXT("T_"), 2);
+    Trie.Add(TEXT("MI_"), 3);
+
+    TestTrue(TEXT("Matches a prefix"), Trie.MatchesAnyPrefix(TEXT("MI_Wood")));
+    TestTrue(TEXT("Matches a prefix case insensitively"), Trie.MatchesAnyPrefix(TEXT("mi_wood")));
+    TestFalse(TEXT("Does not match a partial prefix"), Trie.MatchesAnyPrefix(TEXT("MI")));
+    TestFalse(TEXT("Does not match another prefix"), Trie.MatchesAnyPrefix(TEXT("M_Wood")));
+
+    TArray<int32> Payloads;
+    TArray<int32> Lengths;
+    Trie.ForEachPrefix(TEXT("T_Door"), [&Payloads, &Lengths](const int32 Payload, const int32 Length) {
+        Payloads.Add(Payload);
+        Lengths.Add(Length);
+        return true;
+    });
+    TestEqual(TEXT("Visits the prefixes from the shortest to the longest, keeping the first payload"), Payloads, TArray<int32>({ 0, 1 }));
+    TestEqual(TEXT("Visits the prefixes with their length"), Lengths, TArray<int32>({ 1, 2 }));
+
+    Payloads.Reset();
+    Trie.ForEachPrefix(TEXT("T_Door"), [&Payloads](const int32 Payload, const int32 /*Length*/) {
+        Payloads.Add(Payload);
+        return false;
+    });
+    TestEqual(TEXT("Stops when the visitor returns false"), Payloads, TArray<int32>({ 0 }));
+
+    FNamingConventionPrefixTrie SuffixTrie;
+    SuffixTrie.AddReversed(TEXT("_D"), 0);
+    SuffixTrie.AddReversed(TEXT("_ORM"), 1);
+
+    Payloads.Reset();
+    SuffixTrie.ForEachSuffix(TEXT("T_Wood_orm"), [&Payloads](const int32 Payload, const int32 /*Length*/) {
+        Payloads.Add(Payload);
+        return true;
+    });
+    TestEqual(TEXT("Visits the suffixes case insensitively"), Payloads, TArray<int32>({ 1 }));
+    TestFalse(TEXT("Reversed strings are not prefixes"), SuffixTrie.MatchesAnyPrefix(TEXT("_D")));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNamingConventionTokenMatcherTest, "NamingConventionValidation.StringMatchers.TokenMatcher", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNamingConventionTokenMatcherTest::RunTest(const FString& /*Parameters*/)
+{
+    FNamingConventionTokenMatcher EmptyMatcher;
+    EmptyMatcher.Add(TEXT(""));
+    EmptyMatcher.Compile();
+    TestTrue(TEXT("Empty tokens are ignored"), EmptyMatcher.IsEmpty());
+    TestFalse(TEXT("An empty matcher contains nothing"), EmptyMatcher.ContainsAny(TEXT("Anything")));
+
+    FNamingConventionTokenMatcher Matcher;
+    Matcher.Add(TEXT("abcd"));
+    Matcher.Add(TEXT("bc"));
+    Matcher.Add(TEXT("Old"));
+    Matcher.Compile();
+
+    TestTrue(TEXT("Finds a token at the start"), Matcher.ContainsAny(TEXT("OldDoor")));
+    TestTrue(TEXT("Finds a token at the end"), Matcher.ContainsAny(TEXT("SM_Door_old")));
+    TestTrue(TEXT("Finds a token inside a longer partial token"), Matcher.ContainsAny(TEXT("xabcx")));
+    TestTrue(TEXT("Finds a token case insensitively"), Matcher.ContainsAny(TEXT("XBCX")));
+    TestFalse(TEXT("Follows the failure links without matching"), Matcher.ContainsAny(TEXT("abdabd")));
+    TestFalse(TEXT("Does not match a name without any token"), Matcher.ContainsAny(TEXT("SM_Door")));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNamingConventionAffixMatcherTest, "NamingConventionValidation.StringMatchers.AffixMatcher", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNamingConventionAffixMatcherTest::RunTest(const FString& /*Parameters*/)
+{
+    FNamingConventionAffixMatcher PrefixMatcher;
+    PrefixMatcher.Compile(TEXT("T; T_ ;MI_"), FNamingConventionAffixMatcher::EAffixType::Prefix);
+
+    TestEqual(TEXT("Trims the alternatives"), PrefixMatcher.GetAlternatives(), TArray<FString>({ TEXT("T"), TEXT("T_"), TEXT("MI_") }));
+    TestEqual(TEXT("Returns the longest alternative"), PrefixMatcher.FindMatch(TEXT("T_Door")), 1);
+    TestEqual(TEXT("Returns a shorter alternative"), PrefixMatcher.FindMatch(TEXT("TDoor")), 0);
+    TestEqual(TEXT("Matches case insensitively"), PrefixMatcher.FindMatch(TEXT("mi_Wood")), 2);
+    TestEqual(TEXT("Does not match another prefix"), PrefixMatcher.FindMatch(TEXT("M_Wood")), INDEX_NONE);
+
+    FNamingConventionAffixMatcher SuffixMatcher;
+    SuffixMatcher.Compile(TEXT("_D;_N"), FNamingConventionAffixMatcher::EAffixType::Suffix);
+
+    TestEqual(TEXT("Matches a suffix"), SuffixMatcher.FindMatch(TEXT("T_Wood_N")), 1);
+    TestEqual(TEXT("Does not match a suffix as a prefix"), SuffixMatcher.FindMatch(TEXT("_D_Wood")), INDEX_NONE);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNamingConventionPatternMatcherTest, "NamingConventionValidation.StringMatchers.PatternMatcher", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNamingConventionPatternMatcherTest::RunTest(const FString& /*Parameters*/)
+{
+    struct FLiteralsCase
+    {
+        const TCHAR* Pattern;
+        ENamingConventionPatternSyntax Syntax;
+        const TCHAR* Prefix;
+        const TCHAR* Suffix;
+    };
+
+    const FLiteralsCase LiteralsCases[] = {
+        { TEXT("Foo"), ENamingConventionPatternSyntax::Regex, TEXT("Foo"), TEXT("") },
+        { TEXT("^Foo$"), ENamingConventionPatternSyntax::Regex, TEXT("Foo"), TEXT("") },
+        { TEXT("SM_.*_LOD"), ENamingConventionPatternSyntax::Regex, TEXT("SM_"), TEXT("_LOD") },
+        { TEXT("T_[A-Z][A-Za-z0-9]*_(D|N)"), ENamingConventionPatternSyntax::Regex, TEXT("T_"), TEXT("") },
+        { TEXT("Ab+c"), ENamingConventionPatternSyntax::Regex, TEXT("A"), TEXT("c") },
+        { TEXT("a\\db"), ENamingConventionPatternSyntax::Regex, TEXT("a"), TEXT("b") },
+        { TEXT("A|B"), ENamingConventionPatternSyntax::Regex, TEXT(""), TEXT("") },
+        { TEXT("(?i)foo"), ENamingConventionPatternSyntax::Regex, TEXT(""), TEXT("") },
+        { TEXT("Foo"), ENamingConventionPatternSyntax::Wildcard, TEXT("Foo"), TEXT("") },
+        { TEXT("T_*_D"), ENamingConventionPatternSyntax::Wildcard, TEXT("T_"), TEXT("_D") },
+        { TEXT("T_?ood"), ENamingConventionPatternSyntax::Wildcard, TEXT("T_"), TEXT("ood") },
+    };
+
+    for (const FLiteralsCase& Case : LiteralsCases)
+    {
+        FNamingConventionPatternMatcher Matcher;
+        Matcher.Compile(Case.Pattern, Case.Syntax);
+        TestEqual(FString::Printf(TEXT("Literal prefix of %s"), Case.Pattern), Matcher.GetLiteralPrefix(), FString(Case.Prefix));
+        TestEqual(FString::Printf(TEXT("Literal suffix of %s"), Case.Pattern), Matcher.GetLiteralSuffix(), FString(Case.Suffix));
+    }
+
+    struct FMatchCase
+    {
+        const TCHAR* Pattern;
+        ENamingConventionPatternSyntax Syntax;
+        const TCHAR* Name;
+        bool bMatches;
+    };
+
+    const FMatchCase MatchCases[] = {
+        { TEXT("Foo"), ENamingConventionPatternSyntax::Regex, TEXT("Foo"), true },
+        { TEXT("^Foo$"), ENamingConventionPatternSyntax::Regex, TEXT("Foo"), true },
+        { TEXT("Foo"), ENamingConventionPatternSyntax::Regex, TEXT("Foo2"), false },
+        { TEXT("Foo"), ENamingConventionPatternSyntax::Regex, TEXT("foo"), false },
+        { TEXT("SM_.*_LOD"), ENamingConventionPatternSyntax::Regex, TEXT("SM__LOD"), true },
+        { TEXT("T_[A-Z][A-Za-z0-9]*_(D|N)"), ENamingConventionPatternSyntax::Regex, TEXT("T_Wood_D"), true },
+        { TEXT("T_[A-Z][A-Za-z0-9]*_(D|N)"), ENamingConventionPatternSyntax::Regex, TEXT("T_wood_D"), false },
+        { TEXT("Ab+c"), ENamingConventionPatternSyntax::Regex, TEXT("Abbc"), true },
+        { TEXT("A|B"), ENamingConventionPatternSyntax::Regex, TEXT("B"), true },
+        { TEXT("(?i)foo"), ENamingConventionPatternSyntax::Regex, TEXT("FOO"), true },
+        { TEXT("Foo"), ENamingConventionPatternSyntax::Wildcard, TEXT("foo"), true },
+        { TEXT("T_*_D"), ENamingConventionPatternSyntax::Wildcard, TEXT("t_wood_d"), true },
+        { TEXT("T_*_D"), ENamingConventionPatternSyntax::Wildcard, TEXT("T_D"), false },
+        { TEXT("T_?ood"), ENamingConventionPatternSyntax::Wildcard, TEXT("T_Wood"), true },
+    };
+
+    for (const FMatchCase& Case : MatchCases)
+    {
+        FNamingConventionPatternMatcher Matcher;
+        Matcher.Compile(Case.Pattern, Case.Syntax);
+        TestEqual(FString::Printf(TEXT("%s matching %s"), Case.Pattern, Case.Name), Matcher.Matches(Case.Name), Case.bMatches);
+    }
+
+    return true;
+}
+
+#endif
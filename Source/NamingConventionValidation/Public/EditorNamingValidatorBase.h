@@ -3,6 +3,7 @@
 #include "NamingConventionValidationTypes.h"
 
 #include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
 #include "UObject/NoExportTypes.h"
 
 #include "EditorNamingValidatorBase.generated.h"
@@ -15,6 +16,8 @@ class NAMINGCONVENTIONVALIDATION_API UEditorNamingValidatorBase : public UObject
 public:
     UEditorNamingValidatorBase();
 
+    // Only called for the assets matching SupportedAssetClasses and SupportedPathRoots.
+    // By default, returns true when the validator declares any supported path root or, through GetSupportedAssetClasses, any supported class
     UFUNCTION(BlueprintNativeEvent, BlueprintPure, Category = "Asset Naming Validation")
     bool CanValidateAssetNaming(const UClass* AssetClass, const FAssetData& AssetData) const;
 
@@ -23,7 +26,28 @@ public:
 
     virtual bool IsEnabled() const;
 
+    float GetTimeBudgetSeconds() const;
+
+    // Classes of the assets this validator handles, including their child classes. Empty when it may handle any asset
+    virtual void GetSupportedAssetClasses(TArray<FTopLevelAssetPath>& OutClassPaths) const;
+
+    // Both only use the declarations of the validator, so they never run any script
+    bool SupportsAssetClass(const UClass* AssetClass) const;
+    bool SupportsPackageName(FName PackageName) const;
+
 protected:
     UPROPERTY(EditAnywhere, Category = "Asset Validation", DisplayName = "IsEnabled", Meta = (BlueprintProtected = true))
     uint8 bIsEnabled : 1;
+
+    // The validator is only used for the assets of those classes, or of their child classes. When empty, CanValidateAssetNaming is called for all the assets
+    UPROPERTY(EditAnywhere, Category = "Asset Validation", Meta = (AllowAbstract = true))
+    TArray<TSoftClassPtr<UObject>> SupportedAssetClasses;
+
+    // The validator is only used for the assets in those folders. When empty, it is used for the assets of any folder
+    UPROPERTY(EditAnywhere, Category = "Asset Validation", Meta = (LongPackageName))
+    TArray<FDirectoryPath> SupportedPathRoots;
+
+    // Total time this validator can spend during a single validation. Overrides ValidatorTimeBudgetSeconds of the settings when greater than 0
+    UPROPERTY(EditAnywhere, Category = "Asset Validation", Meta = (ClampMin = 0, Units = "s"))
+    float TimeBudgetSeconds;
 };
@@ -1,14 +1,45 @@
 #pragma once
 
 #include "NamingConventionValidationTypes.h"
+#include "NamingConventionViolationIndex.h"
 
 #include "CoreMinimal.h"
 #include "EditorSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Engine/StreamableManager.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/TopLevelAssetPath.h"
 
 #include "EditorNamingValidatorSubsystem.generated.h"
 
+class FNamingConventionValidationCache;
+class FNamingConventionValidationMergedReportSink;
+class INamingConventionValidationReportSink;
 class UEditorNamingValidatorBase;
 struct FAssetData;
+struct FNamingConventionAssetValidation;
+struct FNamingConventionLiveValidationBatch;
+struct FNamingConventionValidationClassVerdict;
+
+struct FNamingConventionValidationOptions
+{
+    bool bShowIfNoFailures = true;
+
+    // Headless runs can skip the message log, which keeps every message in memory
+    bool bUseMessageLog = true;
+
+    // Whether the results are recorded in the violation index, which the content browser reads. Off for results which are not about real assets
+    bool bUpdateViolationIndex = true;
+
+    // Optional. Additional destinations of the results, which receive them as they are produced
+    TArray<INamingConventionValidationReportSink*> ReportSinks;
+
+    // Overrides bAllowLoadingAssetsToResolveClass of the settings: the assets whose class is not known without loading them or their class are deferred
+    bool bNeverLoadAssets = false;
+
+    // Optional. Results of a previous run are reused for the assets found in the cache, and the cache is updated with the new results
+    FNamingConventionValidationCache* Cache = nullptr;
+};
 
 UCLASS( Config = Editor )
 class NAMINGCONVENTIONVALIDATION_API UEditorNamingValidatorSubsystem final : public UEditorSubsystem
@@ -22,19 +53,70 @@ public:
     void Deinitialize() override;
 
     int32 ValidateAssets(const TArray<FAssetData>& AssetDataList, bool bSkipExcludedDirectories = true, bool bShowIfNoFailures = true) const;
+    int32 ValidateAssets(const TArray<FAssetData>& AssetDataList, const FNamingConventionValidationOptions& Options) const;
     void ValidateSavedPackage(FName PackageName);
     void AddValidator(UEditorNamingValidatorBase* Validator);
     ENamingConventionValidationResult IsAssetNamedCorrectly(FText& ErrorMessage, const FAssetData& AssetData, bool bCanUseEditorValidators = true) const;
 
+    // Hash of everything which can change the result of a validation: the settings and the enabled validators
+    uint64 GetValidationFingerprint() const;
+
+    // Cost of each editor validator since the start of the last call to ValidateAssets, from the most expensive to the cheapest
+    TArray<FNamingConventionValidatorStats> GetValidatorStats() const;
+
+    // Invalid assets found by all the validations run in this session, kept up to date by the saves, the renames and the live validation
+    const FNamingConventionViolationIndex& GetViolationIndex() const;
+
+    // Checks the name of the asset against the rules of the settings only, without the editor validators. ClassVerdict is null when the class of the asset is unknown.
+    // Needs neither the editor nor the asset registry, and is safe to call from any thread
+    static ENamingConventionValidationResult DoesAssetMatchRules(FNamingConventionValidationMessage& Message, const FAssetData& AssetData, const FNamingConventionValidationClassVerdict* ClassVerdict);
+    // Class of the asset as known by the registry: the generated class of blueprints, the asset class otherwise
+    static FTopLevelAssetPath GetAssetClassPath(const FAssetData& AssetData);
+
 private:
+    // Times the private stages of the validation
+    friend class UNamingConventionValidationBenchmarkCommandlet;
+
+    // Only reads the registry tags of the editor utility blueprints. The validators which are not loaded yet are streamed asynchronously
     void RegisterBlueprintValidators();
+    void OnBlueprintValidatorLoaded(FSoftObjectPath ValidatorPath);
+    void AddBlueprintValidator(UObject* ValidatorObject);
+    // Blocks until the blueprint validators still being loaded are registered. Only called by the validations which run the validators
+    void WaitForBlueprintValidators() const;
     void CleanupValidators();
+    // Registry events. They only queue the assets for the live validation, so they stay cheap during the scans of the registry
+    void OnAssetAdded(const FAssetData& AssetData);
+    void OnAssetRemoved(const FAssetData& AssetData);
+    void OnAssetUpdated(const FAssetData& AssetData) const;
+    void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+    void InvalidateClassAncestryIndex(const FAssetData& AssetData) const;
+    // Runs the parallel stage of the queued assets in a background task, then their game thread stage once it is done
+    bool TickLiveValidation(float DeltaTime);
+    // The background task reads the settings and the classes of the assets, so it has to be over before they change or are collected
+    void WaitForLiveValidationBatch() const;
+    // The results of the batch are discarded and its assets are queued again, as they were validated with the previous settings
+    void CancelLiveValidationBatch();
+    void OnSettingsChanging();
     void ValidateAllSavedPackages();
-    void ValidateOnSave(const TArray<FAssetData>& AssetDataList) const;
-    ENamingConventionValidationResult DoesAssetMatchNameConvention(FText& ErrorMessage, const FAssetData& AssetData, FName AssetClass, bool bCanUseEditorValidators = true) const;
-    bool IsClassExcluded(FText& ErrorMessage, const UClass* AssetClass) const;
-    ENamingConventionValidationResult DoesAssetMatchesClassDescriptions(FText& ErrorMessage, const UClass* AssetClass, const FString& AssetName) const;
+    // Validates the next saved assets for at most ValidateOnSaveTimeSliceSeconds, and schedules itself for the next tick until all of them are validated
+    void ValidateSavedAssetsTimeSlice();
+    // Looks up the class of the asset without loading anything. Only called from the game thread, or while it waits for the parallel stage of ValidateAssets
+    void ResolveAssetClass(FNamingConventionAssetValidation& Validation, const FAssetData& AssetData, bool bAllowLoading) const;
+    // Runs all the checks which are safe to run on any thread, once ResolveAssetClass has run. Never looks up any object.
+    // Sets Validation.GameThreadStage if some work is left for ValidateAssetOnGameThread
+    void ValidateAssetOffGameThread(FNamingConventionAssetValidation& Validation, const FAssetData& AssetData, bool bRunValidators) const;
+    void ValidateAssetOnGameThread(FNamingConventionAssetValidation& Validation, const FAssetData& AssetData, bool bRunValidators) const;
+    // ClassVerdict is null when the class of the asset is unknown. AssetClass is only needed by the editor validators
+    void DoesAssetMatchNameConvention(FNamingConventionAssetValidation& Validation, const FAssetData& AssetData, const FNamingConventionValidationClassVerdict* ClassVerdict, const UClass* AssetClass, bool bRunValidators) const;
+    static bool IsClassExcluded(FNamingConventionValidationMessage& Message, const FNamingConventionValidationClassVerdict& ClassVerdict);
+    static ENamingConventionValidationResult DoesAssetMatchesClassDescriptions(FNamingConventionValidationMessage& Message, const FNamingConventionValidationClassVerdict& ClassVerdict, const FString& AssetName);
+    // Only turns a valid result into an invalid one, when the asset name lacks the keywords of its folder
+    static void DoesAssetMatchFolderRule(FNamingConventionValidationMessage& Message, ENamingConventionValidationResult& Result, int32 FolderRuleIndex, const FString& AssetName);
     ENamingConventionValidationResult DoesAssetMatchesValidators(FText& ErrorMessage, const UClass* AssetClass, const FAssetData& AssetData) const;
+    // Validators which declare they may handle assets of the given class, in registration order. Built on first use for each class
+    const TArray<UEditorNamingValidatorBase*>& GetValidatorsForClass(const UClass* AssetClass) const;
+    void AddValidatorTime(FNamingConventionValidatorStats& Stats, const UEditorNamingValidatorBase& Validator, double Seconds) const;
+    bool HasEnabledValidators() const;
 
     UPROPERTY(Config)
     uint8 bAllowBlueprintValidators : 1;
@@ -42,5 +124,25 @@ private:
     UPROPERTY(Transient)
     TMap<UClass*, UEditorNamingValidatorBase*> Validators;
 
-    TArray< FName > SavedPackagesToValidate;
+    TSet< FName > SavedPackagesToValidate;
+    FTimerHandle ValidateSavedPackagesTimerHandle;
+
+    // Assets of the saved packages being validated over several frames, and the report they share
+    TArray<FAssetData> SavedAssetsToValidate;
+    int32 NextSavedAssetIndex = 0;
+    int32 SavedAssetsTimeSliceSize = 256;
+    TSharedPtr<FNamingConventionValidationMergedReportSink> SavedAssetsReportSink;
+
+    TMap<FSoftObjectPath, FAssetData> LiveAssetsToValidate;
+    TSharedPtr<FNamingConventionLiveValidationBatch> LiveValidationBatch;
+    FTSTicker::FDelegateHandle LiveValidationTickerHandle;
+
+    FStreamableManager StreamableManager;
+    TMap<FSoftObjectPath, TSharedPtr<FStreamableHandle>> PendingBlueprintValidators;
+
+    // Only accessed from the game thread, which is the only one running the validators
+    mutable TMap<TObjectKey<UClass>, TArray<UEditorNamingValidatorBase*>> ValidatorsByAssetClass;
+    mutable TMap<TObjectKey<UClass>, FNamingConventionValidatorStats> ValidatorStats;
+    mutable bool bHasDisabledValidators = false;
+    mutable FNamingConventionViolationIndex ViolationIndex;
 };
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "NamingConventionValidationTypes.h"
+
+#include "AssetRegistry/AssetData.h"
+#include "CoreMinimal.h"
+
+struct FNamingConventionValidationOptions;
+
+struct FNamingConventionAssetNameFixOptions
+{
+    // The renames are planned and written to PlanFilename, but no asset is renamed
+    bool bDryRun = false;
+
+    // Optional. Receives one line per planned rename, with the old and the new object paths and the rule which was broken
+    FString PlanFilename;
+
+    // Saves the renamed assets and the fixed up referencers. The editor leaves them dirty, like the renames of the content browser
+    bool bSavePackages = false;
+};
+
+// Renames the assets which break a prefix or suffix rule, computing their new name from the class description they were validated against
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionAssetNameFixer
+{
+public:
+    struct FRename
+    {
+        FAssetData AssetData;
+        FString NewAssetName;
+        ENamingConventionValidationRule Rule;
+    };
+
+    // Corrected name for a validation message, or an empty string when the broken rule cannot be fixed automatically.
+    // A wrong prefix such as T_ is swapped, a missing prefix or suffix is added with the first alternative of the rule
+    static FString GetFixedAssetName(const FAssetData& AssetData, const FNamingConventionValidationMessage& Message);
+
+    // Validates the assets, then renames all the invalid ones which can be fixed in a single batch, with one redirector fix up pass.
+    // Like the renames of the content browser, they cannot be undone. Returns the number of planned renames, or INDEX_NONE when the renames failed
+    static int32 FixAssetNames(const TArray<FAssetData>& AssetDataList, const FNamingConventionValidationOptions& ValidationOptions, const FNamingConventionAssetNameFixOptions& FixOptions);
+
+private:
+    // Leaves out the renames whose new name is already taken, by an existing asset or by another rename
+    static void PlanRenames(const TArray<TPair<FAssetData, FNamingConventionValidationMessage>>& InvalidAssets, TArray<FRename>& OutRenames);
+    static bool WritePlan(const TArray<FRename>& Renames, const FString& PlanFilename);
+    static bool RenameAssets(const TArray<FRename>& Renames, bool bSavePackages);
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "NamingConventionValidationReport.h"
+#include "NamingConventionValidationSettings.h"
+#include "NamingConventionValidationTypes.h"
+
+#include "AssetRegistry/AssetRegistryState.h"
+#include "CoreMinimal.h"
+#include "UObject/TopLevelAssetPath.h"
+
+// Validates the assets of a serialized asset registry, such as AssetRegistry.bin or DevelopmentAssetRegistry.bin, against the rules of the settings.
+// Needs neither the editor nor a scan of the content. The editor validators do not run.
+// The hierarchy of the blueprint classes is read from the tags of the snapshot, the one of the native classes from the classes loaded in the process
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionSnapshotValidator
+{
+public:
+    FNamingConventionSnapshotValidator();
+
+    // Returns false when the file cannot be read
+    bool LoadSnapshot(const FString& Filename);
+    const FAssetRegistryState& GetState() const;
+
+    ENamingConventionValidationResult ValidateAsset(FNamingConventionValidationMessage& OutMessage, const FAssetData& AssetData) const;
+
+    // Assets of the snapshot whose package is in one of the given paths, sub folders included. The pointers are valid as long as the validator
+    void GetAssets(const TArray<FString>& PackagePaths, TArray<const FAssetData*>& OutAssets) const;
+
+    // Sends the results to the sinks, in the order of the assets
+    FNamingConventionValidationSummary ValidateAssets(TConstArrayView<const FAssetData*> Assets, TConstArrayView<INamingConventionValidationReportSink*> ReportSinks) const;
+
+    // Finds the assets of two snapshots which differ by package name, asset name or class, in a single merge pass once both lists are sorted.
+    // A renamed asset is both removed and added. Sorts the input lists
+    static void DiffAssets(TArray<const FAssetData*>& OldAssets, TArray<const FAssetData*>& NewAssets, TArray<const FAssetData*>& OutRemovedAssets, TArray<const FAssetData*>& OutAddedAssets);
+
+    // Pairs the removed and added assets which are the same asset: first the ones of the same package, whose asset name or class changed,
+    // then the ones with the same asset name and class, which moved to another folder. The paired assets are removed from both lists
+    static void PairRenamedAssets(TArray<const FAssetData*>& RemovedAssets, TArray<const FAssetData*>& AddedAssets, TArray<TPair<const FAssetData*, const FAssetData*>>& OutRenamedAssets);
+
+private:
+    void BuildClassHierarchy();
+    // From the class itself to the root of its hierarchy
+    void GetClassHierarchy(const FTopLevelAssetPath& ClassPath, TArray<FTopLevelAssetPath, TInlineAllocator<16>>& OutClassHierarchy) const;
+    const FNamingConventionValidationClassVerdict& GetClassVerdict(const FTopLevelAssetPath& ClassPath) const;
+
+    FAssetRegistryState State;
+
+    // Parent and native parent of each blueprint class of the snapshot. The native parent is used when the parent is missing from the snapshot
+    TMap<FTopLevelAssetPath, FTopLevelAssetPath> ParentClassPaths;
+    TMap<FTopLevelAssetPath, FTopLevelAssetPath> NativeParentClassPaths;
+
+    mutable TMap<FTopLevelAssetPath, FNamingConventionValidationClassVerdict> ClassVerdicts;
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+
+#include "NamingConventionValidationBenchmarkCommandlet.generated.h"
+
+struct FNamingConventionValidationBenchmarkResult
+{
+    FString Benchmark;
+    int32 NumAssets = 0;
+    double AssetsPerSecond = 0.0;
+    double AllocationsPerAsset = 0.0;
+    double AllocatedBytesPerAsset = 0.0;
+    // Peak of the memory used by the whole editor process since it started, as given by the platform
+    double ProcessPeakMemoryMB = 0.0;
+};
+
+// Times the stages of the naming validation on synthetic asset sets, and compares the results with a baseline written by a previous run
+UCLASS( CustomConstructor )
+class NAMINGCONVENTIONVALIDATION_API UNamingConventionValidationBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+
+    UNamingConventionValidationBenchmarkCommandlet();
+
+    // Begin UCommandlet Interface
+    int32 Main( const FString & Params ) override;
+    // End UCommandlet Interface
+
+    // Times every benchmark on a synthetic asset set of each size. Returns false when there is no class description to build the assets from
+    static bool RunBenchmarks( TConstArrayView<int32> Sizes, double MinSeconds, TArray<FNamingConventionValidationBenchmarkResult> & OutResults );
+    // A result fails when its throughput is lower than the one of the baseline by more than Tolerance, or when it allocates more by more than Tolerance
+    static bool CompareWithBaseline( TConstArrayView<FNamingConventionValidationBenchmarkResult> Results, const FString & BaselineFilename, double Tolerance );
+    // The baseline checked in with the plugin, used when no other baseline is given
+    static FString GetDefaultBaselineFilename();
+};
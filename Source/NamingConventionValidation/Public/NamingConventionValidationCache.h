@@ -0,0 +1,78 @@
+#pragma once
+
+#include "NamingConventionValidationTypes.h"
+
+#include "CoreMinimal.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+struct FAssetData;
+
+// Results of a previous validation run, persisted on disk so the assets which did not change are not validated again.
+// The file is memory mapped and only read through binary searches, so loading it is almost free.
+// The whole cache is discarded when the fingerprint of the rules it was written with does not match the current one.
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationCache
+{
+public:
+    explicit FNamingConventionValidationCache(uint64 InFingerprint);
+    ~FNamingConventionValidationCache();
+
+    static FString GetDefaultFilename();
+
+    bool Load(const FString& Filename);
+
+    // Writes the results added since the cache was loaded, along with the loaded ones.
+    // When bDropUnusedResults is true, only the loaded results which have been kept with KeepResult are written back
+    bool Save(const FString& Filename, bool bDropUnusedResults);
+
+    // Thread safe
+    bool TryGetResult(const FAssetData& AssetData, ENamingConventionValidationResult& OutResult, FNamingConventionValidationMessage& OutMessage) const;
+
+    // Must be called from a single thread at a time
+    void AddResult(const FAssetData& AssetData, ENamingConventionValidationResult Result, const FNamingConventionValidationMessage& Message);
+    void KeepResult(const FAssetData& AssetData);
+
+private:
+    struct FHeader
+    {
+        uint32 Magic;
+        uint32 Version;
+        uint64 Fingerprint;
+        uint32 NumEntries;
+        uint32 MessagesSize;
+    };
+
+    // Only the messages of the editor validators are stored as text, the other ones are formatted again from their rule
+    struct FEntry
+    {
+        uint64 Key;
+        uint32 MessageOffset;
+        int32 RuleArgument;
+        uint16 MessageSize;
+        uint8 Result;
+        uint8 Rule;
+        uint32 Padding;
+    };
+
+    struct FPendingEntry
+    {
+        ENamingConventionValidationResult Result;
+        FNamingConventionValidationMessage Message;
+    };
+
+    static uint64 GetKey(const FAssetData& AssetData);
+    const FEntry* FindEntry(uint64 Key) const;
+    FString GetEntryMessage(const FEntry& Entry) const;
+    void Unmap();
+
+    uint64 Fingerprint;
+
+    TUniquePtr<IMappedFileHandle> MappedFileHandle;
+    TUniquePtr<IMappedFileRegion> MappedFileRegion;
+    const FEntry* Entries = nullptr;
+    const UTF8CHAR* Messages = nullptr;
+    int32 NumEntries = 0;
+
+    TSet<uint64> KeptKeys;
+    TMap<uint64, FPendingEntry> PendingEntries;
+};
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "EditorNamingValidatorSubsystem.h"
+#include "NamingConventionAssetNameFixer.h"
+
 #include "Commandlets/Commandlet.h"
 
 #include "NamingConventionValidationCommandlet.generated.h"
@@ -17,5 +20,12 @@ public:
     int32 Main( const FString & Params ) override;
     // End UCommandlet Interface
 
-    static bool ValidateData();
+    // When FixOptions is set, the invalid assets which can be fixed are renamed
+    static bool ValidateData(const FNamingConventionValidationOptions& Options = FNamingConventionValidationOptions(), const FNamingConventionAssetNameFixOptions* FixOptions = nullptr);
+
+    // Validates only the given packages, rescanning their files first. The rest of the content is still discovered by the startup scan of the asset registry
+    static bool ValidatePackages(const TArray<FString>& PackageFilenames, const TArray<FName>& PackageNames, const FNamingConventionValidationOptions& Options = FNamingConventionValidationOptions(), const FNamingConventionAssetNameFixOptions* FixOptions = nullptr);
+
+private:
+    static bool ValidateAssetList(const TArray<FAssetData>& AssetDataList, const FNamingConventionValidationOptions& Options, const FNamingConventionAssetNameFixOptions* FixOptions);
 };
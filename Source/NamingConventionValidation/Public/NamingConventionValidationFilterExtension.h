@@ -0,0 +1,17 @@
+#pragma once
+
+#include "ContentBrowserFrontEndFilterExtension.h"
+
+#include "NamingConventionValidationFilterExtension.generated.h"
+
+// Adds a content browser filter showing the assets in the violation index of the editor subsystem, without validating anything
+UCLASS()
+class UNamingConventionValidationFilterExtension final : public UContentBrowserFrontEndFilterExtension
+{
+    GENERATED_BODY()
+
+public:
+    // Begin UContentBrowserFrontEndFilterExtension Interface
+    void AddFrontEndFilterExtensions(TSharedPtr<FFrontendFilterCategory> DefaultCategory, TArray<TSharedRef<FFrontendFilter>>& InOutFilterList) const override;
+    // End UContentBrowserFrontEndFilterExtension Interface
+};
@@ -0,0 +1,162 @@
+#pragma once
+
+#include "NamingConventionValidationTypes.h"
+
+#include "CoreMinimal.h"
+#include "Logging/MessageLog.h"
+#include "UObject/TopLevelAssetPath.h"
+
+struct FAssetData;
+
+struct NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationSummary
+{
+    void AddResult(ENamingConventionValidationResult Result);
+
+    int32 NumFilesChecked = 0;
+    int32 NumValidFiles = 0;
+    int32 NumInvalidFiles = 0;
+    int32 NumFilesSkipped = 0;
+    int32 NumFilesUnableToValidate = 0;
+    int32 NumFilesDeferred = 0;
+    int32 NumFilesFromCache = 0;
+    int32 NumFilesToValidate = 0;
+    bool bUsedCache = false;
+
+    // From the most expensive validator to the cheapest
+    TArray<FNamingConventionValidatorStats> ValidatorStats;
+};
+
+// Receives the results of UEditorNamingValidatorSubsystem::ValidateAssets one by one, in the order of the validated assets
+class NAMINGCONVENTIONVALIDATION_API INamingConventionValidationReportSink
+{
+public:
+    virtual ~INamingConventionValidationReportSink() = default;
+
+    virtual void BeginReport() {}
+    virtual void AddResult(const FAssetData& AssetData, ENamingConventionValidationResult Result, const FNamingConventionValidationMessage& Message) = 0;
+    virtual void EndReport(const FNamingConventionValidationSummary& Summary) {}
+};
+
+// Merges the results of several calls to ValidateAssets into a single report of the wrapped sink, whose summary covers all of them.
+// The BeginReport and EndReport calls of each validation are not forwarded
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationMergedReportSink final : public INamingConventionValidationReportSink
+{
+public:
+    explicit FNamingConventionValidationMergedReportSink(TUniquePtr<INamingConventionValidationReportSink> InReportSink);
+
+    void AddResult(const FAssetData& AssetData, ENamingConventionValidationResult Result, const FNamingConventionValidationMessage& Message) override;
+
+    void BeginMergedReport();
+    void EndMergedReport();
+
+    const FNamingConventionValidationSummary& GetSummary() const;
+
+private:
+    TUniquePtr<INamingConventionValidationReportSink> ReportSink;
+    FNamingConventionValidationSummary Summary;
+};
+
+// Logs the results in the NamingConventionValidation message log.
+// Results are kept as compact records until the end of the report. When there are more of them than MaxMessageLogAssetLines,
+// they are logged as one line per rule and folder, and the lines of the assets of a group are only formatted when it is expanded.
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationMessageLogSink : public INamingConventionValidationReportSink
+{
+public:
+    explicit FNamingConventionValidationMessageLogSink(bool bInShowIfNoFailures);
+
+    void AddResult(const FAssetData& AssetData, ENamingConventionValidationResult Result, const FNamingConventionValidationMessage& Message) override;
+    void EndReport(const FNamingConventionValidationSummary& Summary) override;
+
+private:
+    struct FRecord
+    {
+        FName PackageName;
+        FTopLevelAssetPath AssetClassPath;
+        FNamingConventionValidationMessage Message;
+    };
+
+    struct FGroup
+    {
+        ENamingConventionValidationResult Result;
+        FName PackagePath;
+        TArray<FRecord> Records;
+    };
+
+    using FGroupKey = TTuple<ENamingConventionValidationResult, ENamingConventionValidationRule, int32, FName>;
+
+    static void AddGroupLine(FMessageLog& MessageLog, const TSharedRef<const FGroup>& Group);
+    // Returns the number of lines added, which is at most MaxLines. When RuleText is not empty, it replaces the messages of the records
+    static int32 AddRecordLines(FMessageLog& MessageLog, const FGroup& Group, int32 MaxLines, const FText& RuleText);
+    static void AddRecordLine(FMessageLog& MessageLog, ENamingConventionValidationResult Result, const FRecord& Record, const FText& RuleText);
+
+    FMessageLog DataValidationLog;
+    TMap<FGroupKey, TSharedRef<FGroup>> Groups;
+    int32 NumRecords = 0;
+    bool bShowIfNoFailures;
+};
+
+// Base class of the sinks which stream the results to a file. Writes are buffered and the file is written incrementally
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationFileSink : public INamingConventionValidationReportSink
+{
+public:
+    explicit FNamingConventionValidationFileSink(const FString& InFilename);
+    virtual ~FNamingConventionValidationFileSink() override;
+
+    // Parses the -Report parameter of the commandlets, a comma separated list of <format>:<filename>, where format is jsonl or junit
+    static bool CreateReportSinks(const FString& ReportParam, TArray<TUniquePtr<FNamingConventionValidationFileSink>>& OutReportSinks);
+
+    bool IsValid() const;
+
+protected:
+    void Write(FStringView Text);
+    void Flush();
+
+    // Offset in the file of the next written character
+    int64 Tell() const;
+
+    // Overwrites ASCII text written earlier at Offset, after flushing the buffer
+    void WriteAt(int64 Offset, FStringView Text);
+
+    // Escapes the characters of Text which need it for the format of the file
+    virtual void AppendEscaped(FStringBuilderBase& Output, FStringView Text) const = 0;
+
+private:
+    FString Filename;
+    TUniquePtr<FArchive> Writer;
+    TUtf8StringBuilder<64 * 1024> Buffer;
+};
+
+// Writes one JSON object per result, followed by one with the summary
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationJsonLinesSink final : public FNamingConventionValidationFileSink
+{
+public:
+    explicit FNamingConventionValidationJsonLinesSink(const FString& InFilename);
+
+    void AddResult(const FAssetData& AssetData, ENamingConventionValidationResult Result, const FNamingConventionValidationMessage& Message) override;
+    void EndReport(const FNamingConventionValidationSummary& Summary) override;
+
+protected:
+    void AppendEscaped(FStringBuilderBase& Output, FStringView Text) const override;
+};
+
+// Writes a JUnit XML test suite with one test case per asset. Invalid assets are failures, excluded and deferred ones are skipped
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationJUnitSink final : public FNamingConventionValidationFileSink
+{
+public:
+    explicit FNamingConventionValidationJUnitSink(const FString& InFilename);
+
+    void BeginReport() override;
+    void AddResult(const FAssetData& AssetData, ENamingConventionValidationResult Result, const FNamingConventionValidationMessage& Message) override;
+    void EndReport(const FNamingConventionValidationSummary& Summary) override;
+
+protected:
+    void AppendEscaped(FStringBuilderBase& Output, FStringView Text) const override;
+
+private:
+    // The opening tags of the suites leave room for their counts, which are only known at the end of the report
+    int64 TestSuitesCountsOffset = 0;
+    int64 TestSuiteCountsOffset = 0;
+    int32 NumTests = 0;
+    int32 NumFailures = 0;
+    int32 NumSkipped = 0;
+};
@@ -1,8 +1,15 @@
 #pragma once
 
+#include "NamingConventionValidationStringMatchers.h"
+#include "NamingConventionValidationTypes.h"
+
 #include "CoreMinimal.h"
 #include "Engine/DeveloperSettings.h"
 #include "Engine/EngineTypes.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/TopLevelAssetPath.h"
+
+#include <atomic>
 
 #include "NamingConventionValidationSettings.generated.h"
 
@@ -12,7 +19,6 @@ struct FNamingConventionValidationClassDescription
     GENERATED_USTRUCT_BODY()
 
     FNamingConventionValidationClassDescription() :
-        Class( nullptr ),
         Priority( 0 )
     {}
 
@@ -20,25 +26,77 @@ struct FNamingConventionValidationClassDescription
     {
         //Make items where class is None show up at the top for config-editing convenience.
         //Otherwise, when clicking the plus to add a new rule in project settings, the sorting moves the newly added None entry down which is highly annoying.
-        return !IsValid(Class) || Priority > Other.Priority || ((Class && Other.Class) ? (Class->GetName() < Other.Class->GetName()) : false);
+        return ClassPath.IsNull() || Priority > Other.Priority || ((!ClassPath.IsNull() && !Other.ClassPath.IsNull()) ? (ClassPath.GetAssetName() < Other.ClassPath.GetAssetName()) : false);
     }
 
     UPROPERTY( Config, EditAnywhere, Meta = ( AllowAbstract = true ) )
     TSoftClassPtr<UObject> ClassPath;
 
-    UPROPERTY( Transient )
-    UClass* Class;
-
+    // Accepted prefixes, separated by ';'
     UPROPERTY( Config, EditAnywhere )
     FString Prefix;
 
+    // Accepted suffixes, separated by ';'
     UPROPERTY( Config, EditAnywhere )
     FString Suffix;
 
+    // Pattern the whole name must match, in addition to the prefix and suffix. For example T_[A-Z][A-Za-z0-9]*_(D|N|ORM)
+    UPROPERTY( Config, EditAnywhere )
+    FString Pattern;
+
+    UPROPERTY( Config, EditAnywhere )
+    ENamingConventionPatternSyntax PatternSyntax = ENamingConventionPatternSyntax::Regex;
+
     UPROPERTY( Config, EditAnywhere )
     int32 Priority;
 };
 
+// Rules of the assets of a folder and of its sub folders. A sub folder which has rules of its own only follows those
+USTRUCT()
+struct FNamingConventionValidationFolderRule
+{
+    GENERATED_USTRUCT_BODY()
+
+    FNamingConventionValidationFolderRule() :
+        bIgnoreClassDescriptions( false )
+    {}
+
+    // A trailing /** is accepted, the rules always apply to the sub folders
+    UPROPERTY( Config, EditAnywhere, Meta = ( LongPackageName ) )
+    FDirectoryPath Folder;
+
+    // Keywords the asset names must contain one of, separated by ';'. For example _Char
+    UPROPERTY( Config, EditAnywhere )
+    FString RequiredKeywords;
+
+    // Relaxed rules: the class descriptions and the blueprint prefix are not checked, only the keywords and the editor validators
+    UPROPERTY( Config, EditAnywhere )
+    uint8 bIgnoreClassDescriptions : 1;
+};
+
+// Prefix, suffix and pattern matchers of a class description, compiled by PostProcessSettings
+struct FNamingConventionValidationClassDescriptionMatchers
+{
+    FNamingConventionAffixMatcher Prefix;
+    FNamingConventionAffixMatcher Suffix;
+    FNamingConventionPatternMatcher Pattern;
+};
+
+// Naming rules resolved for a given asset class. Computed once per class and cached by the settings
+struct FNamingConventionValidationClassVerdict
+{
+    bool IsEmpty() const
+    {
+        return ExcludedClassIndex == INDEX_NONE && ClassDescriptionIndices.IsEmpty();
+    }
+
+    // Index in ExcludedClassPaths of the excluded class the asset class derives from, if any
+    int32 ExcludedClassIndex = INDEX_NONE;
+
+    // Indices in ClassDescriptions of the most precise descriptions matching the asset class, in evaluation order
+    TArray<int32, TInlineAllocator<2>> ClassDescriptionIndices;
+};
+
 UCLASS( Config = Editor, DefaultConfig )
 class NAMINGCONVENTIONVALIDATION_API UNamingConventionValidationSettings final : public UDeveloperSettings
 {
@@ -47,7 +105,9 @@ class NAMINGCONVENTIONVALIDATION_API UNamingConventionValidationSettings final :
 public:
     UNamingConventionValidationSettings();
 
-    bool IsPathExcludedFromValidation( const FString & Path ) const;
+    // Both overloads use the indices built by PostProcessSettings and never allocate
+    bool IsPathExcludedFromValidation( FStringView Path ) const;
+    bool IsPathExcludedFromValidation( FName PackageName ) const;
 
     UPROPERTY( Config, EditAnywhere, Meta = ( LongPackageName, ConfigRestartRequired = true ) )
     TArray<FDirectoryPath> ExcludedDirectories;
@@ -72,26 +132,121 @@ public:
     UPROPERTY( Config, EditAnywhere )
     uint8 bDoesValidateOnSave : 1;
 
+    // Validates the assets as they are added to or renamed in the asset registry, and keeps the live violations of the editor subsystem up to date.
+    // Assets are only validated when it does not require loading them. A full validation is still needed after changing the settings
+    UPROPERTY( Config, EditAnywhere )
+    uint8 bEnableLiveValidation : 1;
+
+    // Saved packages are validated once no other package has been saved for that long, so the packages of a bulk save are validated together
+    UPROPERTY( Config, EditAnywhere, Meta = ( ClampMin = 0, Units = "s", EditCondition = "bDoesValidateOnSave" ) )
+    float ValidateOnSaveDebounceSeconds;
+
+    // Time spent validating saved assets per frame. The assets of large saves are validated over several frames
+    UPROPERTY( Config, EditAnywhere, Meta = ( ClampMin = 0.001, Units = "s", EditCondition = "bDoesValidateOnSave" ) )
+    float ValidateOnSaveTimeSliceSeconds;
+
+    // When unchecked, assets whose class cannot be resolved from the asset registry are reported as deferred instead of being loaded
+    UPROPERTY( Config, EditAnywhere )
+    uint8 bAllowLoadingAssetsToResolveClass : 1;
+
     UPROPERTY( Config, EditAnywhere, Meta = ( ConfigRestartRequired = true ) )
     TArray<FNamingConventionValidationClassDescription> ClassDescriptions;
 
     UPROPERTY( Config, EditAnywhere )
     TArray<TSoftClassPtr<UObject>> ExcludedClassPaths;
 
-    UPROPERTY( Transient )
-    TArray<UClass*> ExcludedClasses;
-
     UPROPERTY( Config, EditAnywhere )
     FString BlueprintsPrefix;
 
+    // When several rules have the same folder, the first one is used
+    UPROPERTY( Config, EditAnywhere )
+    TArray<FNamingConventionValidationFolderRule> FolderRules;
+
+    // Total time an editor validator can spend during a single validation before ValidatorBudgetExceededAction is applied to it. 0 means no budget.
+    // Validators can override it with their own TimeBudgetSeconds
+    UPROPERTY( Config, EditAnywhere, Meta = ( ClampMin = 0, Units = "s" ) )
+    float ValidatorTimeBudgetSeconds;
+
+    UPROPERTY( Config, EditAnywhere )
+    ENamingConventionValidatorBudgetAction ValidatorBudgetExceededAction;
+
+    // When more results than MaxMessageLogAssetLines have to be logged, they are grouped by rule and folder, and each group can be expanded from the message log
+    UPROPERTY( Config, EditAnywhere )
+    uint8 bGroupMessageLogResults : 1;
+
+    // Maximum number of lines about single assets added to the message log at once. 0 means no limit
+    UPROPERTY( Config, EditAnywhere, Meta = ( ClampMin = 0 ) )
+    int32 MaxMessageLogAssetLines;
+
+    // Never loads any class: the rules are compiled on first use, keyed by class path
     void PostProcessSettings();
 
+    // Broadcast on the game thread before the settings or the indices built from them change, so the background readers can be stopped
+    FSimpleMulticastDelegate OnSettingsChanging;
+
+    // Returns the rules which apply to the given class. The result is cached by class path until the next call to PostProcessSettings.
+    // Thread safe
+    FNamingConventionValidationClassVerdict GetClassVerdict( const UClass * AssetClass ) const;
+    // Same, for a class which may not be loaded. Once UpdateClassAncestryIndex has run, this is a single lookup.
+    // Before that, the hierarchy of the class is read from the asset registry
+    FNamingConventionValidationClassVerdict GetClassVerdict( const FTopLevelAssetPath & ClassPath ) const;
+    // Same, for a class whose hierarchy is known by the caller, from the class itself to its root, such as the classes of a registry snapshot.
+    // Neither reads the asset registry nor caches the result
+    FNamingConventionValidationClassVerdict GetClassVerdictFromHierarchy( TConstArrayView<FTopLevelAssetPath> ClassHierarchy ) const;
+
+    // Expands the class of each rule into all the classes the asset registry knows derive from it, including the blueprint classes which are not loaded.
+    // Does nothing when the index is up to date. Thread safe, but blocks the concurrent calls to GetClassVerdict while the index is built
+    void UpdateClassAncestryIndex() const;
+    // To call when the class hierarchy known by the asset registry changes
+    void InvalidateClassAncestryIndex() const;
+    void GetClassVerdictCacheStats( int64 & OutHits, int64 & OutMisses ) const;
+
+    // Matchers of ClassDescriptions[DescriptionIndex]
+    const FNamingConventionValidationClassDescriptionMatchers & GetClassDescriptionMatchers( int32 DescriptionIndex ) const;
+
+    // Index in FolderRules of the rules of the nearest folder containing the package, or INDEX_NONE.
+    // The cost depends on the length of the package name, not on the number of folder rules
+    int32 FindFolderRuleIndex( FName PackageName ) const;
+    // Matches the RequiredKeywords of FolderRules[FolderRuleIndex]
+    const FNamingConventionTokenMatcher & GetFolderRuleKeywordMatcher( int32 FolderRuleIndex ) const;
+
     /* Adds validator class descriptions to some sensible defaults based on Epics recommendations.
      * See https://docs.unrealengine.com/5.1/en-US/recommended-asset-naming-conventions-in-unreal-engine-projects/ 
      * for more information */
     void ResetValidatorClassDescriptionsToEpicDefaults();
 
 #if WITH_EDITOR
+    virtual void PreEditChange(FProperty* PropertyAboutToChange) override;
     virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
-};
\ No newline at end of file
+
+private:
+    void BuildPathIndices();
+    void BuildClassDescriptionMatchers();
+    void BuildFolderRulesIndex();
+    void CompileRules() const;
+    FNamingConventionValidationClassVerdict FindOrAddClassVerdict( const FTopLevelAssetPath & ClassPath, const UClass * AssetClass ) const;
+    FNamingConventionValidationClassVerdict ComputeClassVerdict( const FTopLevelAssetPath & ClassPath, const UClass * AssetClass ) const;
+    FNamingConventionValidationClassVerdict ComputeClassVerdict( TConstArrayView<FTopLevelAssetPath> ClassHierarchy ) const;
+
+    FNamingConventionPrefixTrie ExcludedDirectoriesIndex;
+    FNamingConventionPrefixTrie NonGameFoldersDirectoriesToProcessIndex;
+    FNamingConventionTokenMatcher NonGameFoldersDirectoriesToProcessTokenMatcher;
+    TArray<FNamingConventionValidationClassDescriptionMatchers> ClassDescriptionMatchers;
+    // Folder paths with a trailing slash, so that only whole folder names match
+    FNamingConventionPrefixTrie FolderRulesIndex;
+    TArray<FNamingConventionTokenMatcher> FolderRuleKeywordMatchers;
+
+    // Written by CompileRules under the write lock, then only read under the read lock
+    mutable TMap<FTopLevelAssetPath, TArray<int32, TInlineAllocator<2>>> ClassDescriptionIndicesByClassPath;
+    mutable TMap<FTopLevelAssetPath, int32> ExcludedClassIndexByClassPath;
+    mutable bool bAreRulesCompiled = false;
+    mutable uint32 RulesGeneration = 0;
+    // When set, ClassVerdictCache holds the verdicts of all the classes some rule applies to
+    mutable bool bIsClassAncestryIndexValid = false;
+
+    mutable FRWLock ClassVerdictCacheLock;
+    mutable TMap<FTopLevelAssetPath, FNamingConventionValidationClassVerdict> ClassVerdictCache;
+    mutable std::atomic<int64> ClassVerdictCacheHits = 0;
+    mutable std::atomic<int64> ClassVerdictCacheMisses = 0;
+};
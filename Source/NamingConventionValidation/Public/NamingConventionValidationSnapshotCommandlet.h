@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+
+#include "NamingConventionValidationSnapshotCommandlet.generated.h"
+
+class FNamingConventionSnapshotValidator;
+class INamingConventionValidationReportSink;
+
+// Validates the assets of a serialized asset registry, without starting the editor nor scanning the content
+UCLASS( CustomConstructor )
+class NAMINGCONVENTIONVALIDATION_API UNamingConventionValidationSnapshotCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+
+    UNamingConventionValidationSnapshotCommandlet();
+
+    // Begin UCommandlet Interface
+    int32 Main( const FString & Params ) override;
+    // End UCommandlet Interface
+
+private:
+    // Only validates the assets which changed since the base snapshot. The new violations are sent to ReportSinks, the fixed ones to FixedReportSinks.
+    // The violations of the deleted assets are only counted in the log
+    static bool ValidateDelta(const FString& BaseSnapshotFilename, const FNamingConventionSnapshotValidator& SnapshotValidator, const TArray<FString>& PackagePaths,
+        TConstArrayView<INamingConventionValidationReportSink*> ReportSinks, TConstArrayView<INamingConventionValidationReportSink*> FixedReportSinks);
+};
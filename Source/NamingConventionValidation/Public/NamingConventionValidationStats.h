@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+
+// Enable with -trace=cpu,NamingConventionValidation to see the stages of the validation in Unreal Insights
+UE_TRACE_CHANNEL_EXTERN( NamingConventionValidationChannel, NAMINGCONVENTIONVALIDATION_API )
+
+DECLARE_STATS_GROUP( TEXT( "NamingConventionValidation" ), STATGROUP_NamingConventionValidation, STATCAT_Advanced );
+
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "Validate assets" ), STAT_NamingConventionValidation_ValidateAssets, STATGROUP_NamingConventionValidation, NAMINGCONVENTIONVALIDATION_API );
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "Path exclusion" ), STAT_NamingConventionValidation_PathExclusion, STATGROUP_NamingConventionValidation, NAMINGCONVENTIONVALIDATION_API );
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "Class resolution" ), STAT_NamingConventionValidation_ClassResolution, STATGROUP_NamingConventionValidation, NAMINGCONVENTIONVALIDATION_API );
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "Asset load" ), STAT_NamingConventionValidation_AssetLoad, STATGROUP_NamingConventionValidation, NAMINGCONVENTIONVALIDATION_API );
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "Class load" ), STAT_NamingConventionValidation_ClassLoad, STATGROUP_NamingConventionValidation, NAMINGCONVENTIONVALIDATION_API );
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "Class description matching" ), STAT_NamingConventionValidation_ClassDescriptions, STATGROUP_NamingConventionValidation, NAMINGCONVENTIONVALIDATION_API );
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "Editor validators" ), STAT_NamingConventionValidation_Validators, STATGROUP_NamingConventionValidation, NAMINGCONVENTIONVALIDATION_API );
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "Message log" ), STAT_NamingConventionValidation_MessageLog, STATGROUP_NamingConventionValidation, NAMINGCONVENTIONVALIDATION_API );
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "Validate on save" ), STAT_NamingConventionValidation_ValidateOnSave, STATGROUP_NamingConventionValidation, NAMINGCONVENTIONVALIDATION_API );
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "Validator registration" ), STAT_NamingConventionValidation_RegisterValidators, STATGROUP_NamingConventionValidation, NAMINGCONVENTIONVALIDATION_API );
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN( TEXT( "Assets validated" ), STAT_NamingConventionValidation_AssetsValidated, STATGROUP_NamingConventionValidation, NAMINGCONVENTIONVALIDATION_API );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN( TEXT( "Assets loaded" ), STAT_NamingConventionValidation_AssetsLoaded, STATGROUP_NamingConventionValidation, NAMINGCONVENTIONVALIDATION_API );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN( TEXT( "Classes loaded" ), STAT_NamingConventionValidation_ClassesLoaded, STATGROUP_NamingConventionValidation, NAMINGCONVENTIONVALIDATION_API );
+
+TRACE_DECLARE_INT_COUNTER_EXTERN( NamingConventionValidation_AssetsLoaded );
+TRACE_DECLARE_INT_COUNTER_EXTERN( NamingConventionValidation_ClassesLoaded );
+
+// Times a stage of the validation both in the stats system and in the trace channel of the plugin
+#define NAMING_CONVENTION_VALIDATION_SCOPE( StatId ) \
+    SCOPE_CYCLE_COUNTER( StatId ); \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL( StatId, NamingConventionValidationChannel )
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "NamingConventionValidationTypes.h"
+
+#include "CoreMinimal.h"
+#include "Internationalization/Regex.h"
+
+// Case insensitive character trie. Finds which of the strings it was built from start a given text, without allocating.
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionPrefixTrie
+{
+public:
+    FNamingConventionPrefixTrie();
+
+    void Reset();
+
+    // Empty strings are ignored. When the same string is added twice, the first payload is kept
+    void Add(FStringView Prefix, int32 Payload = 0);
+    // Adds the string backwards, to be found by ForEachSuffix
+    void AddReversed(FStringView Suffix, int32 Payload = 0);
+
+    bool IsEmpty() const;
+
+    // Returns true if any of the added strings is a prefix of Text
+    bool MatchesAnyPrefix(FStringView Text) const;
+
+    // Calls Visitor(Payload, PrefixLength) for each added string which is a prefix of Text, from the shortest to the longest.
+    // The iteration stops as soon as the visitor returns false
+    template <typename VisitorType>
+    void ForEachPrefix(FStringView Text, VisitorType&& Visitor) const
+    {
+        int32 NodeIndex = 0;
+        for (int32 CharIndex = 0; CharIndex < Text.Len(); ++CharIndex)
+        {
+            NodeIndex = FindChild(NodeIndex, Text[CharIndex]);
+            if (NodeIndex == INDEX_NONE)
+            {
+                return;
+            }
+
+            if (Nodes[NodeIndex].Payload != INDEX_NONE && !Visitor(Nodes[NodeIndex].Payload, CharIndex + 1))
+            {
+                return;
+            }
+        }
+    }
+
+    // Same as ForEachPrefix, for the strings added with AddReversed which are a suffix of Text
+    template <typename VisitorType>
+    void ForEachSuffix(FStringView Text, VisitorType&& Visitor) const
+    {
+        int32 NodeIndex = 0;
+        for (int32 CharIndex = 0; CharIndex < Text.Len(); ++CharIndex)
+        {
+            NodeIndex = FindChild(NodeIndex, Text[Text.Len() - 1 - CharIndex]);
+            if (NodeIndex == INDEX_NONE)
+            {
+                return;
+            }
+
+            if (Nodes[NodeIndex].Payload != INDEX_NONE && !Visitor(Nodes[NodeIndex].Payload, CharIndex + 1))
+            {
+                return;
+            }
+        }
+    }
+
+private:
+    struct FNode
+    {
+        // Sorted by lower case character
+        TArray<TPair<TCHAR, int32>> Children;
+        int32 Payload = INDEX_NONE;
+    };
+
+    int32 FindChild(int32 NodeIndex, TCHAR Character) const;
+
+    TArray<FNode> Nodes;
+};
+
+// Case insensitive Aho-Corasick automaton. Finds whether a text contains any of the tokens it was built from in a single pass.
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionTokenMatcher
+{
+public:
+    FNamingConventionTokenMatcher();
+
+    void Reset();
+
+    // Empty tokens are ignored. Compile must be called once all the tokens have been added
+    void Add(FStringView Token);
+    void Compile();
+
+    bool IsEmpty() const;
+    bool ContainsAny(FStringView Text) const;
+
+private:
+    struct FNode
+    {
+        // Sorted by lower case character
+        TArray<TPair<TCHAR, int32>> Children;
+        int32 Fail = 0;
+        bool bIsMatch = false;
+    };
+
+    int32 FindChild(int32 NodeIndex, TCHAR Character) const;
+
+    TArray<FNode> Nodes;
+};
+
+// Alternatives of a prefix or suffix rule, written as a ';' separated list such as "M_;MI_;MF_".
+// Tells which alternative a name matches in a single pass over its characters, case insensitively
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionAffixMatcher
+{
+public:
+    enum class EAffixType : uint8
+    {
+        Prefix,
+        Suffix
+    };
+
+    void Compile(const FString& AffixList, EAffixType InAffixType);
+
+    bool IsEmpty() const;
+
+    // Returns the index of the longest alternative matching Name, or INDEX_NONE
+    int32 FindMatch(FStringView Name) const;
+
+    const TArray<FString>& GetAlternatives() const;
+
+private:
+    FNamingConventionPrefixTrie Trie;
+    TArray<FString> Alternatives;
+    EAffixType AffixType = EAffixType::Prefix;
+};
+
+// Pattern a whole name must match, compiled once.
+// The literal prefix and suffix which every matching name has are extracted from the pattern, so that most of the names
+// which do not match are rejected by a comparison, without running the pattern engine
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionPatternMatcher
+{
+public:
+    void Compile(const FString& InPattern, ENamingConventionPatternSyntax InSyntax);
+
+    bool IsEmpty() const;
+    bool Matches(const FString& Name) const;
+
+    const FString& GetPattern() const;
+
+    // Text every matching name starts or ends with. Empty when the pattern is too complex to be sure of it
+    const FString& GetLiteralPrefix() const;
+    const FString& GetLiteralSuffix() const;
+
+private:
+    FString Pattern;
+    ENamingConventionPatternSyntax Syntax = ENamingConventionPatternSyntax::Regex;
+    TOptional<FRegexPattern> RegexPattern;
+    FString LiteralPrefix;
+    FString LiteralSuffix;
+};
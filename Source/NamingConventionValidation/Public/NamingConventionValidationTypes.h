@@ -1,5 +1,7 @@
 #pragma once
 
+#include "CoreMinimal.h"
+
 #include "NamingConventionValidationTypes.generated.h"
 
 UENUM()
@@ -8,5 +10,84 @@ enum class ENamingConventionValidationResult : uint8
     Invalid,
     Valid,
     Unknown,
-    Excluded
-};
\ No newline at end of file
+    Excluded,
+    // The class of the asset could not be resolved without loading it
+    Deferred
+};
+
+// Rule which decided the result of the validation of an asset
+UENUM()
+enum class ENamingConventionValidationRule : uint8
+{
+    None,
+    ExcludedDirectory,
+    ExcludedClass,
+    Deferred,
+    UnknownClass,
+    WrongPrefix,
+    WrongSuffix,
+    BlueprintPrefix,
+    // The message comes from an editor validator
+    Validator,
+    WrongPattern,
+    FolderKeyword
+};
+
+// Syntax of the pattern of a class description
+UENUM()
+enum class ENamingConventionPatternSyntax : uint8
+{
+    // ICU regular expression, matched against the whole name, case sensitively
+    Regex,
+    // '*' matches any sequence of characters and '?' any character, case insensitively
+    Wildcard
+};
+
+// Explanation of a validation result. Only the rule and its argument are stored, the text is formatted on demand.
+// The argument is an index in the settings, so the messages kept while the settings change must be resolved first
+struct NAMINGCONVENTIONVALIDATION_API FNamingConventionValidationMessage
+{
+    FNamingConventionValidationMessage() = default;
+    FNamingConventionValidationMessage(ENamingConventionValidationRule InRule, int32 InRuleArgument = INDEX_NONE);
+
+    FText ToText() const;
+
+    // Formats the text with the current settings and keeps it, so that it does not depend on the rule argument anymore
+    void Resolve();
+
+    ENamingConventionValidationRule Rule = ENamingConventionValidationRule::None;
+
+    // Index in ClassDescriptions for the prefix, suffix and pattern rules, index in ExcludedClasses for the excluded class rule,
+    // index in FolderRules for the folder keyword rule
+    int32 RuleArgument = INDEX_NONE;
+
+    // Set for the messages of the editor validators, which cannot be formatted again, and for the resolved messages
+    FText Text;
+};
+
+// What happens to an editor validator which exceeds its time budget
+UENUM()
+enum class ENamingConventionValidatorBudgetAction : uint8
+{
+    // The validator runs after all the other ones, only for the assets they give no verdict for
+    Demote,
+    // The validator does not run anymore until the end of the validation
+    Disable
+};
+
+// Cost of an editor validator during the last validation
+struct FNamingConventionValidatorStats
+{
+    FString ValidatorName;
+
+    // Calls to CanValidateAssetNaming, calls to ValidateAssetNaming, and validations which gave another result than Unknown
+    int64 NumCalls = 0;
+    int64 NumValidations = 0;
+    int64 NumVerdicts = 0;
+
+    double TotalSeconds = 0.0;
+    double MaxSeconds = 0.0;
+
+    bool bIsDemoted = false;
+    bool bIsDisabled = false;
+};
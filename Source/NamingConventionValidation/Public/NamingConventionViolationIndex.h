@@ -0,0 +1,63 @@
+#pragma once
+
+#include "NamingConventionValidationTypes.h"
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/TopLevelAssetPath.h"
+
+struct FAssetData;
+
+// Invalid assets found by the validations, updated incrementally as results come. The violations are per asset, as a package can hold several.
+// Counts per folder, sub folders included, and per class are kept up to date, so they are answered in constant time
+class NAMINGCONVENTIONVALIDATION_API FNamingConventionViolationIndex
+{
+public:
+    struct FViolation
+    {
+        FSoftObjectPath AssetPath;
+        FName PackageName;
+        FName PackagePath;
+        FTopLevelAssetPath AssetClassPath;
+        FNamingConventionValidationMessage Message;
+    };
+
+    // Adds or updates the violation of the asset when the result is invalid, removes it otherwise
+    void Update(const FAssetData& AssetData, ENamingConventionValidationResult Result, const FNamingConventionValidationMessage& Message);
+    void Remove(const FSoftObjectPath& AssetPath);
+    void Reset();
+
+    // Resolves the messages of the violations, before the settings their rule arguments refer to change
+    void ResolveMessages();
+
+    int32 Num() const;
+    bool Contains(const FSoftObjectPath& AssetPath) const;
+    // The pointer is valid until the next update of the index
+    const FViolation* Find(const FSoftObjectPath& AssetPath) const;
+
+    int32 GetNumViolationsInFolder(FName FolderPath) const;
+    int32 GetNumViolationsOfClass(const FTopLevelAssetPath& AssetClassPath) const;
+
+    // Linear in the number of violations found. The pointers are valid until the next update of the index
+    void GetViolationsInFolder(FName FolderPath, TArray<const FViolation*>& OutViolations) const;
+    void GetViolationsOfClass(const FTopLevelAssetPath& AssetClassPath, TArray<const FViolation*>& OutViolations) const;
+
+    // Visits every folder which holds violations, with their number, sub folders included
+    void ForEachFolder(TFunctionRef<void(FName FolderPath, int32 NumViolations)> Visitor) const;
+
+private:
+    struct FFolder
+    {
+        int32 NumViolations = 0;
+        TSet<FSoftObjectPath> AssetPaths;
+        TSet<FName> SubFolderPaths;
+    };
+
+    void AddViolation(FViolation&& Violation);
+    void RemoveViolation(const FViolation& Violation);
+    void GetViolationsInFolder(const FFolder& Folder, TArray<const FViolation*>& OutViolations) const;
+
+    TMap<FSoftObjectPath, FViolation> Violations;
+    TMap<FName, FFolder> Folders;
+    TMap<FTopLevelAssetPath, TSet<FSoftObjectPath>> AssetPathsByClass;
+};